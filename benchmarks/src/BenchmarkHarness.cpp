@@ -0,0 +1,245 @@
+// File: BenchmarkHarness.cpp     
+// Purpose: Build synthetic problems and time solver kernels on them
+// Date: October 18, 2026
+
+#include "BenchmarkHarness.h"
+
+using namespace std;
+
+//==============================================================================
+/// BenchmarkHarness class object constructor. Parses command line options.
+///
+/// @param [in] argc number of command line arguments 
+/// @param [in] argv command line arguments 
+BenchmarkHarness::BenchmarkHarness(int argc,char ** argv)
+{
+
+  string option,value,item;
+  size_t split;
+
+  sizes = {{10,10},{50,50},{100,100},{200,100},{400,200}};
+  groups = {1,4,16};
+
+  for (int iArg = 1; iArg + 1 < argc; iArg += 2)
+  {
+    option = argv[iArg];
+    value = argv[iArg+1];
+    stringstream list(value);
+
+    if (option == "--sizes")
+    {
+      sizes.clear();
+      while (getline(list,item,','))
+      {
+        split = item.find('x');
+        sizes.push_back(make_pair(stoi(item.substr(0,split)),\
+              stoi(item.substr(split+1))));
+      }
+    }
+    else if (option == "--groups")
+    {
+      groups.clear();
+      while (getline(list,item,','))
+        groups.push_back(stoi(item));
+    }
+    else if (option == "--reps")
+      reps = stoi(value);
+    else if (option == "--filter")
+      filter = value;
+    else if (option == "--label")
+      label = value;
+    else if (option == "--output")
+      outputFile = value;
+    else
+      cout << "Unknown option " << option << " ignored." << endl;
+  }
+
+  if (not outputFile.empty())
+  {
+    // Only write the header to a new file so results from several builds 
+    // can be appended and compared
+    bool exists = ifstream(outputFile).good();
+    output.open(outputFile,ios::app);
+    if (not exists)
+      output << "label,benchmark,nZ,nR,nGroups,reps,min_s,median_s,mean_s,"\
+        << "min_per_unit_s" << endl;
+  }
+
+  cout << "label,benchmark,nZ,nR,nGroups,reps,min_s,median_s,mean_s,"\
+    << "min_per_unit_s" << endl;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// BenchmarkHarness class object destructor
+///
+BenchmarkHarness::~BenchmarkHarness()
+{
+
+  output.close();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Build input for a homogeneous, flowing fuel salt problem with the 
+/// requested number of cells and energy groups
+///
+/// @param [in] nZ number of axial cells
+/// @param [in] nR number of radial cells
+/// @param [in] nGroups number of energy groups
+/// @return input node
+YAML::Node BenchmarkHarness::makeInput(int nZ,int nR,int nGroups)
+{
+
+  YAML::Node input;
+  vector<double> sigT,sigS,sigF,nu,neutV,chiP,chiD,flux;
+
+  // Downscatter into the next group only, with all fission neutrons born in
+  // the fastest group
+  for (int iGroup = 0; iGroup < nGroups; iGroup++)
+  {
+    sigT.push_back(1.0 + 0.1*iGroup);
+    sigF.push_back(0.02 + 0.01*iGroup);
+    nu.push_back(2.43);
+    neutV.push_back(2.2E5*pow(10.0,nGroups-1-iGroup));
+    chiP.push_back(iGroup == 0 ? 1.0 : 0.0);
+    chiD.push_back(iGroup == 0 ? 1.0 : 0.0);
+    flux.push_back(1.0);
+    for (int iPrime = 0; iPrime < nGroups; iPrime++)
+    {
+      if (iPrime == iGroup)
+        sigS.push_back(0.8);
+      else if (iPrime == iGroup + 1)
+        sigS.push_back(0.1);
+      else
+        sigS.push_back(0.0);
+    }
+  }
+
+  // Mesh cells are the corner cells of the transport mesh
+  input["mesh"]["Z"] = (double) nZ;
+  input["mesh"]["R"] = (double) nR;
+  input["mesh"]["dz"] = 2.0;
+  input["mesh"]["dr"] = 2.0;
+  input["mesh"]["dt"] = 0.01;
+  input["mesh"]["T"] = 0.01;
+  input["mesh"]["recirculation Z"] = (double) nZ;
+
+  input["geometry"]["background"] = "fuel salt";
+
+  input["delayed neutron precursors"]["betas"] = vector<double>{0.0015,0.003};
+  input["delayed neutron precursors"]["lambdas"] = vector<double>{0.03,0.3};
+
+  YAML::Node fuel = input["materials"]["fuel salt"];
+  fuel["sigT"] = sigT;
+  fuel["sigF"] = sigF;
+  fuel["sigS"] = sigS;
+  fuel["nu"] = nu;
+  fuel["neutV"] = neutV;
+  fuel["chiP"] = chiP;
+  fuel["chiD"] = chiD;
+  fuel["density"] = 2.146E-3;
+  fuel["cP"] = 1967.0;
+  fuel["k"] = 0.0553;
+  fuel["gamma"] = 0.0;
+  fuel["omega"] = 3.204E-11;
+  fuel["material velocity"] = 21.45;
+  fuel["stationary"] = false;
+
+  YAML::Node params = input["parameters"];
+  params["epsAlpha"] = 1E-3;
+  params["epsFlux"] = 1E-5;
+  params["epsFissionSource"] = 1E-5;
+  params["epsEddington"] = 1E-6;
+  params["upperBC"] = vector<double>{0.0};
+  params["lowerBC"] = vector<double>{0.0};
+  params["outerBC"] = vector<double>{0.0};
+  params["initial flux"] = flux;
+  params["initial alpha"] = vector<double>{1E-15};
+  params["initial previous flux"] = flux;
+  params["initial dnp concentration"] = 0.0;
+  params["initial recirc dnp concentration"] = 0.0;
+  params["wallTemp"] = 920.0;
+  params["inletTemp"] = 920.0;
+  params["mgqd-bcs"] = "goldin";
+  params["outputDirectory"] = "benchmark-output/";
+
+  return input;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Check whether a benchmark passes the filter
+///
+/// @param [in] name name of benchmark
+/// @return whether benchmark should be run
+bool BenchmarkHarness::selected(string name)
+{
+
+  return filter.empty() or name.find(filter) != string::npos;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Time a kernel. The kernel is run once untimed to warm caches, then reps
+/// times. 
+///
+/// @param [in] name name of benchmark
+/// @param [in] nZ number of axial cells
+/// @param [in] nR number of radial cells
+/// @param [in] nGroups number of energy groups
+/// @param [in] units amount of work done by one call, e.g. number of 
+///   ordinates swept, used to report time per unit 
+/// @param [in] kernel work to time
+void BenchmarkHarness::run(string name,int nZ,int nR,int nGroups,\
+    double units,function<void()> kernel)
+{
+
+  vector<double> times;
+  double median,mean;
+  stringstream line;
+
+  if (not selected(name))
+    return;
+
+  kernel();
+
+  for (int iRep = 0; iRep < reps; iRep++)
+  {
+    auto begin = chrono::high_resolution_clock::now();
+    kernel();
+    auto end = chrono::high_resolution_clock::now();
+    auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+    times.push_back(elapsed.count()*1e-9);
+  }
+
+  sort(times.begin(),times.end());
+  median = times[times.size()/2];
+  mean = accumulate(times.begin(),times.end(),0.0)/times.size();
+
+  line << label << "," << name << "," << nZ << "," << nR << "," << nGroups\
+    << "," << reps << "," << scientific << setprecision(6) << times[0] << ","\
+    << median << "," << mean << "," << times[0]/units;
+
+  report(line.str());
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write a line of results to the console and output file
+///
+/// @param [in] line line of results
+void BenchmarkHarness::report(string line)
+{
+
+  cout << line << endl;
+  if (output.is_open())
+    output << line << endl;
+
+};
+//==============================================================================
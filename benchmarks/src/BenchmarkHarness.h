@@ -0,0 +1,46 @@
+#ifndef BENCHMARKHARNESS_H
+#define BENCHMARKHARNESS_H
+
+#include <functional>
+#include <fstream>
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include "../../libs/Mesh.h"
+
+using namespace std;
+
+//==============================================================================
+//! Runs parameterized micro-benchmarks over synthetic problems and reports
+///   timings in a stable CSV format
+///
+/// Command line options:
+///   --sizes 10x10,50x50    axial x radial cell counts
+///   --groups 1,4,16        numbers of energy groups
+///   --reps 5               timed repetitions of each kernel
+///   --filter name          only run benchmarks whose name contains name
+///   --label text           label identifying this build, e.g. a commit hash
+///   --output file.csv      append results to file.csv
+
+class BenchmarkHarness
+{
+  public:
+    BenchmarkHarness(int argc,char ** argv);
+    ~BenchmarkHarness();
+    vector< pair<int,int> > sizes;
+    vector<int> groups;
+    int reps = 5;
+    string filter = "", label = "", outputFile = "";
+    YAML::Node makeInput(int nZ,int nR,int nGroups);
+    bool selected(string name);
+    void run(string name,int nZ,int nR,int nGroups,double units,\
+        function<void()> kernel);
+
+  private:
+    ofstream output;
+    void report(string line);
+};
+
+//==============================================================================
+
+#endif
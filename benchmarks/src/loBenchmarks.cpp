@@ -0,0 +1,70 @@
+#include "BenchmarkHarness.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiGroupTransport.h"
+#include "../../libs/MultiGroupQD.h"
+#include "../../libs/MultiPhysicsCoupledQD.h"
+#include "../../libs/MultiGroupQDToMultiPhysicsQDCoupling.h"
+#include "../../libs/MultilevelCoupling.h"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Low-order kernel benchmarks");
+
+  BenchmarkHarness harness(argc,argv);
+
+  for (auto size : harness.sizes)
+  {
+    for (int nGroups : harness.groups)
+    {
+      int nZ = size.first, nR = size.second;
+      YAML::Node * input = new YAML::Node(harness.makeInput(nZ,nR,nGroups));
+      Mesh * mesh = new Mesh(input);
+      Materials * mats = new Materials(mesh,input);
+      MultiGroupTransport * mgt = new MultiGroupTransport(mats,mesh,input);
+      MultiGroupQD * mgqd = new MultiGroupQD(mats,mesh,input);
+      MultiPhysicsCoupledQD * mpqd = new MultiPhysicsCoupledQD(mats,mesh,\
+          input);
+      MultilevelCoupling * coupling = new MultilevelCoupling(mesh,mats,input,\
+          mgt,mgqd,mpqd);
+      MGQDToMPQDCoupling * collapse = new MGQDToMPQDCoupling(mesh,mats,input,\
+          mpqd,mgqd);
+      Eigen::VectorXd xGuess;
+
+      // MGLOQD system, reported per cell and group
+      harness.run("mgloqd_assembly",nZ,nR,nGroups,nZ*nR*nGroups,[&](){
+          mgqd->buildLinearSystem();});
+      harness.run("mgloqd_direct_solve",nZ,nR,nGroups,nZ*nR*nGroups,[&](){
+          mgqd->solveLinearSystem();});
+      harness.run("mgloqd_iterative_solve",nZ,nR,nGroups,nZ*nR*nGroups,[&](){
+          mgqd->QDSolve->x.setZero();
+          mgqd->solveLinearSystemIterative();});
+      harness.run("mgloqd_back_calc",nZ,nR,nGroups,nZ*nR*nGroups,[&](){
+          mgqd->buildBackCalcSystem();
+          mgqd->backCalculateCurrent();});
+
+      // ELOT system, reported per cell
+      harness.run("elot_collapse",nZ,nR,nGroups,nZ*nR,[&](){
+          collapse->collapseNuclearData();});
+      harness.run("elot_assembly",nZ,nR,nGroups,nZ*nR,[&](){
+          mpqd->buildLinearSystem();});
+      harness.run("elot_direct_solve",nZ,nR,nGroups,nZ*nR,[&](){
+          mpqd->solveLinearSystem();});
+      xGuess = mpqd->x;
+      harness.run("elot_iterative_solve",nZ,nR,nGroups,nZ*nR,[&](){
+          mpqd->solveLinearSystemIterative(xGuess);});
+
+      delete collapse;
+      delete coupling;
+      delete mpqd;
+      delete mgqd;
+      delete mgt;
+      delete mats;
+      delete mesh;
+      delete input;
+    }
+  }
+
+  PetscFinalize();
+}
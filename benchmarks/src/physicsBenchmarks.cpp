@@ -0,0 +1,73 @@
+#include "BenchmarkHarness.h"
+#include "../../libs/Materials.h"
+#include "../../libs/Material.h"
+#include "../../libs/MultiPhysicsCoupledQD.h"
+#include "../../libs/HeatTransfer.h"
+#include "../../libs/MultiGroupDNP.h"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Physics kernel benchmarks");
+
+  BenchmarkHarness harness(argc,argv);
+
+  // Temperature table with 20 entries 
+  Eigen::MatrixXd table(20,2);
+  for (int iRow = 0; iRow < table.rows(); iRow++)
+  {
+    table(iRow,0) = 800.0 + 25.0*iRow;
+    table(iRow,1) = 1.0 - 1E-4*iRow;
+  }
+
+  for (auto size : harness.sizes)
+  {
+    for (int nGroups : harness.groups)
+    {
+      int nZ = size.first, nR = size.second;
+      YAML::Node * input = new YAML::Node(harness.makeInput(nZ,nR,nGroups));
+      Mesh * mesh = new Mesh(input);
+      Materials * mats = new Materials(mesh,input);
+      MultiPhysicsCoupledQD * mpqd = new MultiPhysicsCoupledQD(mats,mesh,\
+          input);
+      vector<Eigen::MatrixXd> tables(nGroups,table);
+      Eigen::VectorXd chi = Eigen::VectorXd::Ones(nGroups);
+      Material * fuel = new Material(0,"fuel salt",tables,tables,tables,\
+          tables,tables,chi,chi,1.0,0.0,1.0,1.0,1.0);
+      double sum = 0.0;
+
+      // Cross section lookup in every cell and group
+      harness.run("interpolate_parameter",nZ,nR,nGroups,nZ*nR*nGroups,[&](){
+          for (int iGroup = 0; iGroup < nGroups; iGroup++)
+            for (int iZ = 0; iZ < nZ; iZ++)
+              for (int iR = 0; iR < nR; iR++)
+                sum += fuel->interpolateParameter(table,\
+                    800.0 + 500.0*(iZ*nR + iR)/(nZ*nR));});
+
+      // Flux-limited advection of temperature, reported per cell
+      harness.run("heat_flux_limiter",nZ,nR,nGroups,nZ*nR,[&](){
+          mpqd->heat->calcFluxes();});
+
+      // Flux-limited advection of all precursor groups in the core and 
+      // recirculation loop, reported per cell and precursor group
+      harness.run("dnp_flux_limiter",nZ,nR,nGroups,\
+          nZ*nR*mpqd->mgdnp->DNPs.size(),[&](){
+          for (int iDNP = 0; iDNP < mpqd->mgdnp->DNPs.size(); iDNP++)
+          {
+            mpqd->mgdnp->DNPs[iDNP]->calcCoreDNPFluxes();
+            mpqd->mgdnp->DNPs[iDNP]->calcRecircDNPFluxes();
+          }});
+
+      if (sum < 0.0) cout << sum << endl;
+
+      delete fuel;
+      delete mpqd;
+      delete mats;
+      delete mesh;
+      delete input;
+    }
+  }
+
+  PetscFinalize();
+}
@@ -0,0 +1,60 @@
+#include "BenchmarkHarness.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiGroupTransport.h"
+#include "../../libs/SingleGroupTransport.h"
+#include "../../libs/StartingAngle.h"
+#include "../../libs/SimpleCornerBalance.h"
+#include "../../libs/MultiGroupQD.h"
+#include "../../libs/TransportToQDCoupling.h"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Transport kernel benchmarks");
+
+  BenchmarkHarness harness(argc,argv);
+
+  for (auto size : harness.sizes)
+  {
+    for (int nGroups : harness.groups)
+    {
+      int nZ = size.first, nR = size.second;
+      YAML::Node * input = new YAML::Node(harness.makeInput(nZ,nR,nGroups));
+      Mesh * mesh = new Mesh(input);
+      Materials * mats = new Materials(mesh,input);
+      MultiGroupTransport * mgt = new MultiGroupTransport(mats,mesh,input);
+      MultiGroupQD * mgqd = new MultiGroupQD(mats,mesh,input);
+      TransportToQDCoupling * coupling = new TransportToQDCoupling(mats,mesh,\
+          input,mgt,mgqd);
+      shared_ptr<SingleGroupTransport> sgt = mgt->SGTs[0];
+
+      // One SCB sweep over all ordinates of a group, reported per ordinate
+      harness.run("scb_sweep",nZ,nR,nGroups,mesh->nAngles,[&](){
+          mgt->SCBSolve->solve(&(sgt->aFlux),&(sgt->aHalfFlux),&(sgt->q),\
+              &(sgt->alpha),0);});
+
+      // Starting angle solves of a group
+      harness.run("starting_angle",nZ,nR,nGroups,mesh->quadrature.size(),\
+          [&](){mgt->startAngleSolve->calcStartingAngle(&(sgt->aHalfFlux),\
+            &(sgt->q),&(sgt->alpha),0);});
+
+      // Eddington factors and boundary conditions of all groups from 
+      // angular fluxes, reported per cell and group
+      mgt->solveStartAngles();
+      mgt->solveSCBs();
+      harness.run("eddington_factors",nZ,nR,nGroups,nZ*nR*nGroups,[&](){
+          coupling->calcEddingtonFactors();
+          coupling->calcBCs();});
+
+      delete coupling;
+      delete mgqd;
+      delete mgt;
+      delete mats;
+      delete mesh;
+      delete input;
+    }
+  }
+
+  PetscFinalize();
+}
@@ -21,6 +21,8 @@ static char help[] = "Solves CFR reactor kinetics problem with KSP.\n\n";
 #include "../libs/MultiGroupQDToMultiPhysicsQDCoupling.h"
 #include "../libs/MultilevelCoupling.h"
 #include "../libs/PETScWrapper.h"
+#include "../libs/Profiler.h"
+#include "../libs/Logger.h"
 #include "../libs/MMS.h"
 #include "../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
 
@@ -102,19 +104,6 @@ int main(int argc, char** argv) {
   MMS * myMMS;
   myMMS = new MMS(myMGT,myMesh,myMaterials,input);
 
-  // Set number of procs
-  if ((*input)["parameters"]["nprocs"]){
-    int nProcs = (*input)["parameters"]["nprocs"].as<int>();
-    Eigen::initParallel();
-    omp_set_num_threads(nProcs);
-    Eigen::setNbThreads(nProcs);
-  }
-  else
-  {
-    omp_set_num_threads(1);
-    Eigen::setNbThreads(1);
-  }
-
   if ((*input)["parameters"]["solve type"]){
 
     solveType=(*input)["parameters"]["solve type"].as<string>();
@@ -163,6 +152,12 @@ int main(int argc, char** argv) {
     myMGT->solveTransportOnly();
   }
 
+  // Write profile report and any output still queued for the background 
+  // writer
+  myMesh->profiler->writeReport();
+  myMesh->logger->flush();
+  myMesh->output->finish();
+
   // Delete pointers
 
   delete myMesh;
@@ -0,0 +1,332 @@
+// File: Checkpoint.cpp     
+// Purpose: Save and restore named solver state in a binary file 
+// Date: October 18, 2026
+
+#include "Checkpoint.h"
+#include "Logger.h"
+
+using namespace std;
+
+//==============================================================================
+/// Checkpoint class object constructor
+///
+/// @param [in] mySaving true to collect fields for writing, false to assign
+///   fields from a file that has been read
+/// @param [in] myLogger logger that reports problems with the file
+Checkpoint::Checkpoint(bool mySaving,Logger * myLogger)
+{
+
+  saving = mySaving;
+  logger = myLogger;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load a Eigen::MatrixXd
+///
+/// @param [in] name unique label of the field
+/// @param [in,out] data field to save or load into
+void Checkpoint::field(string name,Eigen::MatrixXd & data)
+{
+
+  Record * record;
+
+  if (saving)
+  {
+    store(name,data.data(),data.rows(),data.cols(),1);
+    return;
+  }
+
+  record = find(name);
+  if (record == NULL) return;
+  data.resize(record->rows,record->cols);
+  copy(record->data.begin(),record->data.end(),data.data());
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load a Eigen::VectorXd
+///
+/// @param [in] name unique label of the field
+/// @param [in,out] data field to save or load into
+void Checkpoint::field(string name,Eigen::VectorXd & data)
+{
+
+  Record * record;
+
+  if (saving)
+  {
+    store(name,data.data(),data.size(),1,1);
+    return;
+  }
+
+  record = find(name);
+  if (record == NULL) return;
+  data.resize(record->rows);
+  copy(record->data.begin(),record->data.end(),data.data());
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load a Eigen::VectorXi
+///
+/// @param [in] name unique label of the field
+/// @param [in,out] data field to save or load into
+void Checkpoint::field(string name,Eigen::VectorXi & data)
+{
+
+  Eigen::VectorXd converted;
+
+  if (saving)
+    converted = data.cast<double>();
+
+  field(name,converted);
+
+  if (not saving and converted.size() > 0)
+    data = converted.cast<int>();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load a vector of Eigen::MatrixXd
+///
+/// @param [in] name unique label of the field
+/// @param [in,out] data field to save or load into
+void Checkpoint::field(string name,vector<Eigen::MatrixXd> & data)
+{
+
+  int size = data.size();
+
+  field(name + "/size",size);
+  data.resize(size);
+
+  for (int iMat = 0; iMat < size; iMat++)
+    field(name + "/" + to_string(iMat),data[iMat]);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load an arma::cube
+///
+/// @param [in] name unique label of the field
+/// @param [in,out] data field to save or load into
+void Checkpoint::field(string name,arma::cube & data)
+{
+
+  Record * record;
+
+  if (saving)
+  {
+    store(name,data.memptr(),data.n_rows,data.n_cols,data.n_slices);
+    return;
+  }
+
+  record = find(name);
+  if (record == NULL) return;
+  data.set_size(record->rows,record->cols,record->slices);
+  copy(record->data.begin(),record->data.end(),data.memptr());
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load a double
+///
+/// @param [in] name unique label of the field
+/// @param [in,out] data field to save or load into
+void Checkpoint::field(string name,double & data)
+{
+
+  Record * record;
+
+  if (saving)
+  {
+    store(name,&data,1,1,1);
+    return;
+  }
+
+  record = find(name);
+  if (record == NULL) return;
+  data = record->data[0];
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load an integer
+///
+/// @param [in] name unique label of the field
+/// @param [in,out] data field to save or load into
+void Checkpoint::field(string name,int & data)
+{
+
+  double converted = data;
+
+  field(name,converted);
+  data = (int) converted;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Copy a field into the archive
+///
+/// @param [in] name unique label of the field
+/// @param [in] data pointer to column-major data
+/// @param [in] rows number of rows
+/// @param [in] cols number of columns
+/// @param [in] slices number of slices
+void Checkpoint::store(string name,const double * data,int rows,int cols,\
+    int slices)
+{
+
+  if (records.count(name) == 0)
+    order.push_back(name);
+
+  Record & record = records[name];
+
+  record.rows = rows;
+  record.cols = cols;
+  record.slices = slices;
+  record.data.assign(data,data + rows*cols*slices);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Look up a field that was read from file
+///
+/// @param [in] name unique label of the field
+/// @return pointer to the record, or NULL if it is not in the checkpoint
+Checkpoint::Record * Checkpoint::find(string name)
+{
+
+  map<string,Record>::iterator it = records.find(name);
+
+  if (it == records.end())
+  {
+    logger->warning("Checkpoint") << "Checkpoint does not contain " << name \
+      << "; keeping its initialized value." << endl;
+    nMissing++;
+    return NULL;
+  }
+
+  return &(it->second);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write all saved fields to a file. The file is first written under a
+/// temporary name and then renamed, so an interrupted write never replaces
+/// a good checkpoint.
+///
+/// @param [in] fileName path of checkpoint file
+/// @return whether the file was written
+bool Checkpoint::write(string fileName)
+{
+
+  ofstream file;
+  string tempName = fileName + ".tmp";
+  int byteOrder = 1, nRecords = order.size(), nameLength;
+
+  file.open(tempName,ios::out | ios::binary | ios::trunc);
+  if (not file.is_open())
+  {
+    logger->warning("Checkpoint") << "Could not open checkpoint file " \
+      << tempName << endl;
+    return false;
+  }
+
+  file.write("QMCHK001",8);
+  file.write(reinterpret_cast<const char*>(&byteOrder),sizeof(int));
+  file.write(reinterpret_cast<const char*>(&nRecords),sizeof(int));
+
+  for (int iRecord = 0; iRecord < nRecords; iRecord++)
+  {
+    Record & record = records[order[iRecord]];
+    nameLength = order[iRecord].size();
+    file.write(reinterpret_cast<const char*>(&nameLength),sizeof(int));
+    file.write(order[iRecord].c_str(),nameLength);
+    file.write(reinterpret_cast<const char*>(&record.rows),sizeof(int));
+    file.write(reinterpret_cast<const char*>(&record.cols),sizeof(int));
+    file.write(reinterpret_cast<const char*>(&record.slices),sizeof(int));
+    file.write(reinterpret_cast<const char*>(record.data.data()),\
+        record.data.size()*sizeof(double));
+  }
+
+  file.close();
+  if (file.fail())
+  {
+    logger->warning("Checkpoint") << "Failed to write checkpoint file " \
+      << tempName << endl;
+    return false;
+  }
+
+  return rename(tempName.c_str(),fileName.c_str()) == 0;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read all fields from a file
+///
+/// @param [in] fileName path of checkpoint file
+/// @return whether the file was read
+bool Checkpoint::read(string fileName)
+{
+
+  ifstream file;
+  char tag[8];
+  int byteOrder, nRecords, nameLength;
+  string name;
+
+  file.open(fileName,ios::in | ios::binary);
+  if (not file.is_open())
+  {
+    logger->warning("Checkpoint") << "Could not open checkpoint file " \
+      << fileName << endl;
+    return false;
+  }
+
+  file.read(tag,8);
+  file.read(reinterpret_cast<char*>(&byteOrder),sizeof(int));
+  if (string(tag,8) != "QMCHK001" or byteOrder != 1)
+  {
+    logger->warning("Checkpoint") << fileName \
+      << " is not a checkpoint written on this machine." << endl;
+    return false;
+  }
+
+  file.read(reinterpret_cast<char*>(&nRecords),sizeof(int));
+  for (int iRecord = 0; iRecord < nRecords and file.good(); iRecord++)
+  {
+    file.read(reinterpret_cast<char*>(&nameLength),sizeof(int));
+    name.resize(nameLength);
+    file.read(&name[0],nameLength);
+
+    Record & record = records[name];
+    file.read(reinterpret_cast<char*>(&record.rows),sizeof(int));
+    file.read(reinterpret_cast<char*>(&record.cols),sizeof(int));
+    file.read(reinterpret_cast<char*>(&record.slices),sizeof(int));
+    record.data.resize(record.rows*record.cols*record.slices);
+    file.read(reinterpret_cast<char*>(record.data.data()),\
+        record.data.size()*sizeof(double));
+  }
+
+  if (file.fail())
+  {
+    logger->warning("Checkpoint") << "Checkpoint file " << fileName \
+      << " is truncated." << endl;
+    return false;
+  }
+
+  return true;
+
+};
+//==============================================================================
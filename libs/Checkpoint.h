@@ -0,0 +1,48 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "Mesh.h"
+#include <map>
+
+using namespace std;
+
+class Logger;
+
+//==============================================================================
+//! Binary archive of named solver state used to checkpoint and restart runs.
+///
+/// The same sequence of field calls is used to save and to load, so the 
+/// state that is written cannot drift from the state that is read back.
+
+class Checkpoint
+{
+  public:
+    Checkpoint(bool mySaving,Logger * myLogger);
+    bool saving;
+    int nMissing = 0;
+    void field(string name,Eigen::MatrixXd & data);
+    void field(string name,Eigen::VectorXd & data);
+    void field(string name,Eigen::VectorXi & data);
+    void field(string name,vector<Eigen::MatrixXd> & data);
+    void field(string name,arma::cube & data);
+    void field(string name,double & data);
+    void field(string name,int & data);
+    bool write(string fileName);
+    bool read(string fileName);
+
+  private:
+    struct Record
+    {
+      int rows,cols,slices;
+      vector<double> data;
+    };
+    Logger * logger;
+    map<string,Record> records;
+    vector<string> order;
+    void store(string name,const double * data,int rows,int cols,int slices);
+    Record * find(string name);
+};
+
+//==============================================================================
+
+#endif
@@ -0,0 +1,333 @@
+// File: CoarseMeshTransport.cpp
+// Purpose: Solve the MGHOT problem on a coarsened spatial mesh and carry its
+//   angular fluxes back to the mesh of the low order problems
+// Date: October 18, 2026
+
+#include "CoarseMeshTransport.h"
+#include "SingleGroupTransport.h"
+#include "Profiler.h"
+#include "Logger.h"
+
+using namespace std;
+
+//==============================================================================
+/// CoarseMeshTransport class object constructor
+///
+/// @param [in] myMesh fine mesh shared with the low order problems
+/// @param [in] myMaterials materials on the fine mesh
+/// @param [in] myInput input object
+/// @param [in] myMGT multigroup transport object on the fine mesh
+CoarseMeshTransport::CoarseMeshTransport(Mesh * myMesh,\
+  Materials * myMaterials,YAML::Node * myInput,MultiGroupTransport * myMGT)
+{
+
+  mesh = myMesh;
+  materials = myMaterials;
+  input = myInput;
+  MGT = myMGT;
+
+  checkOptionalParams();
+
+  if (enabled)
+    buildCoarseMesh();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Build the coarse mesh and the materials and transport objects on it
+///
+void CoarseMeshTransport::buildCoarseMesh()
+{
+
+  vector<double> boundsZ,boundsR;
+
+  // Region boundaries stay cell edges so each coarse cell holds one material
+  for (auto region : (*input)["geometry"])
+  {
+    if (region.first.as<string>() != "region")
+      continue;
+    boundsZ.push_back(region.second["lower-z"].as<double>());
+    boundsZ.push_back(region.second["upper-z"].as<double>());
+    boundsR.push_back(region.second["inner-r"].as<double>());
+    boundsR.push_back(region.second["outer-r"].as<double>());
+  }
+
+  // The coarse mesh is described by its cell edges
+  coarseInput = YAML::Clone(*input);
+  coarseInput["mesh"].remove("z zones");
+  coarseInput["mesh"].remove("r zones");
+  coarseInput["mesh"].remove("align to geometry");
+  coarseInput["mesh"]["z edges"] = coarsenEdges(mesh->zEdge,factorZ,boundsZ);
+  coarseInput["mesh"]["r edges"] = coarsenEdges(mesh->rEdge,factorR,boundsR);
+
+  // Output, profiling, logging, and threading stay with the fine mesh
+  coarseMesh = new Mesh(&coarseInput,mesh);
+  coarseMaterials = new Materials(coarseMesh,&coarseInput);
+  coarseMGT = new MultiGroupTransport(coarseMaterials,coarseMesh,&coarseInput);
+
+  // Restriction by overlapping volume, prolongation by linear interpolation
+  // between corner centers
+  overlapZ = calcOverlap(mesh->zCornerEdge,coarseMesh->zCornerEdge,false);
+  overlapR = calcOverlap(mesh->rCornerEdge,coarseMesh->rCornerEdge,true);
+  coarseVolume = overlapZ*Eigen::MatrixXd::Ones(mesh->nZ,mesh->nR)\
+    *overlapR.transpose();
+  interpZ = calcInterpolation(mesh->zCornerCent,coarseMesh->zCornerCent);
+  interpR = calcInterpolation(mesh->rCornerCent,coarseMesh->rCornerCent);
+
+  mesh->logger->info("MGHOT") << "MGHOT mesh coarsened to " \
+    << coarseMesh->nZ << " x " << coarseMesh->nR << " corners from " \
+    << mesh->nZ << " x " << mesh->nR << "." << endl;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Select the edges of the coarse mesh from those of the fine mesh
+///
+/// @param [in] edges cell edges of the fine mesh
+/// @param [in] factor number of fine cells merged into each coarse cell
+/// @param [in] keep locations that must remain edges
+/// @return cell edges of the coarse mesh
+vector<double> CoarseMeshTransport::coarsenEdges(const arma::rowvec & edges,\
+  int factor,vector<double> keep)
+{
+
+  vector<double> coarseEdges = {edges(0)};
+  double tol = 1E-10*edges(edges.n_elem-1);
+  int nMerged = 0;
+  bool onBoundary;
+
+  for (int iEdge = 1; iEdge < edges.n_elem; iEdge++)
+  {
+    nMerged++;
+
+    onBoundary = false;
+    for (int iKeep = 0; iKeep < keep.size(); iKeep++)
+      onBoundary = onBoundary or abs(keep[iKeep] - edges(iEdge)) < tol;
+
+    if (nMerged == factor or onBoundary or iEdge == edges.n_elem-1)
+    {
+      coarseEdges.push_back(edges(iEdge));
+      nMerged = 0;
+    }
+  }
+
+  return coarseEdges;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate how much of each fine corner lies in each coarse corner
+///
+/// @param [in] fineEdges corner edges of the fine mesh
+/// @param [in] coarseEdges corner edges of the coarse mesh
+/// @param [in] radial whether to measure overlap as an annular area rather
+///   than a length
+/// @return overlap of coarse corner i and fine corner j in entry (i,j)
+Eigen::MatrixXd CoarseMeshTransport::calcOverlap(\
+  const arma::rowvec & fineEdges,const arma::rowvec & coarseEdges,bool radial)
+{
+
+  int nFine = fineEdges.n_elem - 1,nCoarse = coarseEdges.n_elem - 1;
+  double lower,upper;
+  Eigen::MatrixXd overlap = Eigen::MatrixXd::Zero(nCoarse,nFine);
+
+  for (int iCoarse = 0; iCoarse < nCoarse; iCoarse++)
+  {
+    for (int iFine = 0; iFine < nFine; iFine++)
+    {
+      lower = max(fineEdges(iFine),coarseEdges(iCoarse));
+      upper = min(fineEdges(iFine+1),coarseEdges(iCoarse+1));
+      if (upper <= lower)
+        continue;
+
+      if (radial)
+        overlap(iCoarse,iFine) = M_PI*(upper*upper - lower*lower);
+      else
+        overlap(iCoarse,iFine) = upper - lower;
+    }
+  }
+
+  return overlap;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate weights that linearly interpolate between coarse corner centers.
+/// Fine corners beyond the outermost coarse centers take the nearest value.
+///
+/// @param [in] fineCent corner centers of the fine mesh
+/// @param [in] coarseCent corner centers of the coarse mesh
+/// @return weight of coarse corner j in fine corner i in entry (i,j)
+Eigen::MatrixXd CoarseMeshTransport::calcInterpolation(\
+  const arma::rowvec & fineCent,const arma::rowvec & coarseCent)
+{
+
+  int nFine = fineCent.n_elem,nCoarse = coarseCent.n_elem,iCoarse = 0;
+  double weight;
+  Eigen::MatrixXd interp = Eigen::MatrixXd::Zero(nFine,nCoarse);
+
+  for (int iFine = 0; iFine < nFine; iFine++)
+  {
+    if (fineCent(iFine) <= coarseCent(0))
+    {
+      interp(iFine,0) = 1.0;
+      continue;
+    }
+    if (fineCent(iFine) >= coarseCent(nCoarse-1))
+    {
+      interp(iFine,nCoarse-1) = 1.0;
+      continue;
+    }
+
+    // Fine centers increase, so the bracketing interval only moves outward
+    while (coarseCent(iCoarse+1) < fineCent(iFine))
+      iCoarse++;
+
+    weight = (fineCent(iFine) - coarseCent(iCoarse))\
+      /(coarseCent(iCoarse+1) - coarseCent(iCoarse));
+    interp(iFine,iCoarse) = 1.0 - weight;
+    interp(iFine,iCoarse+1) = weight;
+  }
+
+  return interp;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Volume average a corner field of the fine mesh onto the coarse mesh
+///
+/// @param [in] fineField field on the corners of the fine mesh
+/// @return field on the corners of the coarse mesh
+Eigen::MatrixXd CoarseMeshTransport::restrictField(\
+  const Eigen::MatrixXd & fineField)
+{
+
+  return (overlapZ*fineField*overlapR.transpose()).cwiseQuotient(coarseVolume);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Bring the coarse materials and time step up to date with the fine mesh.
+/// Coarse cells hold a single material, so evaluating cross sections at the
+/// volume averaged temperature restricts them.
+///
+void CoarseMeshTransport::restrictState()
+{
+
+  coarseMesh->state = mesh->state;
+  coarseMaterials->updateTemperature(restrictField(materials->temperature));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Sweep one energy group on the coarse mesh. The source and alpha already
+/// computed on the fine mesh are restricted, and the resulting angular
+/// fluxes are interpolated back to the fine mesh.
+///
+/// @param [in] iGroup energy group to solve
+void CoarseMeshTransport::sweepGroup(int iGroup)
+{
+
+  shared_ptr<SingleGroupTransport> fine = MGT->SGTs[iGroup];
+  shared_ptr<SingleGroupTransport> coarse = coarseMGT->SGTs[iGroup];
+
+  coarse->q = restrictField(fine->q);
+  coarse->alpha = restrictField(fine->alpha);
+  coarse->solveStartAngle();
+  coarse->solveSCB();
+
+  prolongAngularFlux(iGroup);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Sweep every energy group on the coarse mesh
+///
+void CoarseMeshTransport::solve()
+{
+
+  restrictState();
+
+  for (int iGroup = 0; iGroup < MGT->SGTs.size(); iGroup++)
+  {
+    ScopedTimer timer(mesh->profiler,"group");
+    sweepGroup(iGroup);
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Sweep a subset of energy groups on the coarse mesh
+///
+/// @param [in] solveGroup indicates which groups to solve
+void CoarseMeshTransport::solve(VectorXb solveGroup)
+{
+
+  restrictState();
+
+  for (int iGroup = 0; iGroup < MGT->SGTs.size(); iGroup++)
+  {
+    if (not solveGroup(iGroup)) continue;
+    ScopedTimer timer(mesh->profiler,"group");
+    sweepGroup(iGroup);
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Interpolate the angular fluxes of a group from the coarse mesh to the
+/// fine mesh, one ordinate at a time
+///
+/// @param [in] iGroup energy group to prolong
+void CoarseMeshTransport::prolongAngularFlux(int iGroup)
+{
+
+  arma::cube & fineFlux = MGT->SGTs[iGroup]->aFlux;
+  arma::cube & coarseFlux = coarseMGT->SGTs[iGroup]->aFlux;
+  long long fineSize = fineFlux.n_rows*fineFlux.n_cols;
+  long long coarseSize = coarseFlux.n_rows*coarseFlux.n_cols;
+
+  for (int iAngle = 0; iAngle < fineFlux.n_slices; iAngle++)
+  {
+    Eigen::Map<Eigen::MatrixXd> fineSlice(fineFlux.memptr() \
+      + iAngle*fineSize,fineFlux.n_rows,fineFlux.n_cols);
+    Eigen::Map<Eigen::MatrixXd> coarseSlice(coarseFlux.memptr() \
+      + iAngle*coarseSize,coarseFlux.n_rows,coarseFlux.n_cols);
+
+    fineSlice.noalias() = interpZ*coarseSlice*interpR.transpose();
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read coarsening parameters from the input file. Giving either factor 
+/// turns the coarse mesh on, so factors of 1 sweep on a copy of the fine mesh.
+///
+void CoarseMeshTransport::checkOptionalParams()
+{
+
+  if ((*input)["parameters"]["mghotCoarsenZ"])
+  {
+    factorZ = max(1,(*input)["parameters"]["mghotCoarsenZ"].as<int>());
+    enabled = true;
+  }
+
+  if ((*input)["parameters"]["mghotCoarsenR"])
+  {
+    factorR = max(1,(*input)["parameters"]["mghotCoarsenR"].as<int>());
+    enabled = true;
+  }
+
+};
+//==============================================================================
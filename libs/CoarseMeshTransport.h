@@ -0,0 +1,53 @@
+#ifndef COARSEMESHTRANSPORT_H
+#define COARSEMESHTRANSPORT_H
+
+#include "Mesh.h"
+#include "Materials.h"
+#include "MultiGroupTransport.h"
+
+using namespace std;
+
+//==============================================================================
+//! Runs the MGHOT sweeps on a coarsened copy of the spatial mesh. Sources,
+///   alphas, and temperatures are restricted from the fine mesh by volume
+///   weighting, and the angular fluxes are interpolated back to the fine
+///   corners, where the Eddington factors and boundary factors are formed.
+
+class CoarseMeshTransport
+{
+  public:
+    CoarseMeshTransport(Mesh * myMesh,Materials * myMaterials,\
+      YAML::Node * myInput,MultiGroupTransport * myMGT);
+
+    bool enabled = false;
+    int factorZ = 1,factorR = 1;
+    Mesh * coarseMesh = NULL;
+    Materials * coarseMaterials = NULL;
+    MultiGroupTransport * coarseMGT = NULL;
+    void restrictState();
+    void solve();
+    void solve(VectorXb solveGroup);
+    void sweepGroup(int iGroup);
+    Eigen::MatrixXd restrictField(const Eigen::MatrixXd & fineField);
+    void prolongAngularFlux(int iGroup);
+    vector<double> coarsenEdges(const arma::rowvec & edges,int factor,\
+      vector<double> keep);
+    Eigen::MatrixXd calcOverlap(const arma::rowvec & fineEdges,\
+      const arma::rowvec & coarseEdges,bool radial);
+    Eigen::MatrixXd calcInterpolation(const arma::rowvec & fineCent,\
+      const arma::rowvec & coarseCent);
+    void checkOptionalParams();
+
+  private:
+    Mesh * mesh;
+    Materials * materials;
+    YAML::Node * input;
+    YAML::Node coarseInput;
+    MultiGroupTransport * MGT;
+    Eigen::MatrixXd overlapZ,overlapR,coarseVolume,interpZ,interpR;
+    void buildCoarseMesh();
+};
+
+//==============================================================================
+
+#endif
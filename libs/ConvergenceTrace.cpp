@@ -0,0 +1,242 @@
+// File: ConvergenceTrace.cpp
+// Purpose: Record the convergence history of every iteration of the
+//   multilevel solver in a columnar binary file
+// Date: October 18, 2026
+
+#include "ConvergenceTrace.h"
+#include "WriteData.h"
+#include "Profiler.h"
+
+using namespace std;
+
+//==============================================================================
+/// ConvergenceTrace class object constructor
+///
+/// @param [in] myMesh mesh object
+/// @param [in] myInput input object
+ConvergenceTrace::ConvergenceTrace(Mesh * myMesh,YAML::Node * myInput)
+{
+
+  int initialized = 0;
+
+  mesh = myMesh;
+  input = myInput;
+
+  // Every rank iterates identically, so only rank 0 writes the trace
+  MPI_Initialized(&initialized);
+  if (initialized)
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+
+  checkOptionalParams();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// ConvergenceTrace class object destructor
+///
+ConvergenceTrace::~ConvergenceTrace()
+{
+
+  flush();
+  file.close();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Buffer one iteration of a level
+///
+/// @param [in] myLevel level that iterated, one of Level
+/// @param [in] myIteration iteration count of this level in this step
+/// @param [in] residuals flux, temperature, and precursor residuals
+/// @param [in] targets flux and temperature residuals needed to converge
+/// @param [in] myEddingtonResidual largest change in the Eddington factors,
+///   or NaN if they were not recomputed
+/// @param [in] mySeconds time spent in the solve of this level
+/// @param [in] myDecision what the solver did next, one of Decision
+void ConvergenceTrace::record(int myLevel,int myIteration,\
+  vector<double> residuals,vector<double> targets,\
+  double myEddingtonResidual,double mySeconds,int myDecision)
+{
+
+  if (not enabled or rank != 0)
+    return;
+
+  step.push_back(mesh->state);
+  time.push_back(mesh->ts[mesh->state]);
+  level.push_back(myLevel);
+  iteration.push_back(myIteration);
+  fluxResidual.push_back(residuals[0]);
+  tempResidual.push_back(residuals[1]);
+  dnpResidual.push_back(residuals[2]);
+  eddingtonResidual.push_back(myEddingtonResidual);
+  fluxTarget.push_back(targets[0]);
+  tempTarget.push_back(targets[1]);
+  krylovIterations.push_back(pendingKrylov[myLevel]);
+  seconds.push_back(mySeconds);
+  decision.push_back(myDecision);
+
+  pendingKrylov[myLevel] = 0.0;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Mark the start of a linear solve of one level
+///
+void ConvergenceTrace::beginSolve()
+{
+
+  if (enabled)
+    solveStart = mesh->profiler->counter("krylovIterations");
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Attribute the Krylov iterations since beginSolve to a level. They are 
+/// reported with that level's next record.
+///
+/// @param [in] level level that was solved, one of Level
+void ConvergenceTrace::endSolve(int level)
+{
+
+  if (enabled)
+    pendingKrylov[level] += mesh->profiler->counter("krylovIterations") \
+      - solveStart;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Append buffered records to the trace file as one block.
+///
+/// The file starts with the tag "QMCTR001", the integer 1 to mark the byte
+/// order, the number of columns, and then the data type (0 for double, 1 for
+/// int), name length, and name of each column. Each block is the tag "QBLK",
+/// the number of records, and then each column in turn.
+void ConvergenceTrace::flush()
+{
+
+  int nRecords = step.size();
+
+  if (not enabled or nRecords == 0)
+    return;
+
+  if (not file.is_open())
+    writeHeader();
+
+  file.write("QBLK",4);
+  file.write(reinterpret_cast<const char*>(&nRecords),sizeof(int));
+  writeColumn(step);
+  writeColumn(time);
+  writeColumn(level);
+  writeColumn(iteration);
+  writeColumn(fluxResidual);
+  writeColumn(tempResidual);
+  writeColumn(dnpResidual);
+  writeColumn(eddingtonResidual);
+  writeColumn(fluxTarget);
+  writeColumn(tempTarget);
+  writeColumn(krylovIterations);
+  writeColumn(seconds);
+  writeColumn(decision);
+  file.flush();
+
+  mesh->profiler->count("bytesWritten",8 + nRecords*(5*sizeof(int) \
+    + 8*sizeof(double)));
+
+  step.clear(); time.clear(); level.clear(); iteration.clear();
+  fluxResidual.clear(); tempResidual.clear(); dnpResidual.clear();
+  eddingtonResidual.clear(); fluxTarget.clear(); tempTarget.clear();
+  krylovIterations.clear(); seconds.clear(); decision.clear();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Open the trace file and write the column layout. A restarted run appends
+/// its blocks to the file of the run it continues.
+///
+void ConvergenceTrace::writeHeader()
+{
+
+  // Column names and types, in the order written by flush
+  vector<string> names = {"step","time","level","iteration","fluxResidual",\
+    "tempResidual","dnpResidual","eddingtonResidual","fluxTarget",\
+    "tempTarget","krylovIterations","seconds","decision"};
+  vector<int> types = {1,0,1,1,0,0,0,0,0,0,1,0,1};
+  int byteOrder = 1,nColumns = names.size(),nameLength;
+  string dir = mesh->output->getOutputPath("",true);
+
+  mesh->output->makePath(dir);
+  if (restarting)
+  {
+    file.open(dir + fileName,ios::binary | ios::app);
+    return;
+  }
+  file.open(dir + fileName,ios::binary);
+
+  file.write("QMCTR001",8);
+  file.write(reinterpret_cast<const char*>(&byteOrder),sizeof(int));
+  file.write(reinterpret_cast<const char*>(&nColumns),sizeof(int));
+  for (int iColumn = 0; iColumn < nColumns; iColumn++)
+  {
+    nameLength = names[iColumn].size();
+    file.write(reinterpret_cast<const char*>(&types[iColumn]),sizeof(int));
+    file.write(reinterpret_cast<const char*>(&nameLength),sizeof(int));
+    file.write(names[iColumn].c_str(),nameLength);
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write an integer column
+///
+/// @param [in] column values to write
+void ConvergenceTrace::writeColumn(const vector<int> & column)
+{
+
+  file.write(reinterpret_cast<const char*>(column.data()),\
+    column.size()*sizeof(int));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write a double column
+///
+/// @param [in] column values to write
+void ConvergenceTrace::writeColumn(const vector<double> & column)
+{
+
+  file.write(reinterpret_cast<const char*>(column.data()),\
+    column.size()*sizeof(double));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read trace parameters from the input file
+///
+void ConvergenceTrace::checkOptionalParams()
+{
+
+  if ((*input)["parameters"]["convergenceTrace"])
+    enabled = (*input)["parameters"]["convergenceTrace"].as<bool>();
+
+  if ((*input)["parameters"]["convergenceTraceFile"])
+    fileName = (*input)["parameters"]["convergenceTraceFile"].as<string>();
+
+  // A run restarted from a checkpoint continues the existing trace
+  if ((*input)["parameters"]["restartFile"])
+    restarting = true;
+
+  // Krylov iterations are taken from the profiler's counters
+  if (enabled)
+    mesh->profiler->counting = true;
+
+};
+//==============================================================================
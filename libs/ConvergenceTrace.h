@@ -0,0 +1,50 @@
+#ifndef CONVERGENCETRACE_H
+#define CONVERGENCETRACE_H
+
+#include <fstream>
+#include "Mesh.h"
+
+using namespace std;
+
+//==============================================================================
+//! Records one row per iteration of each level of the multilevel solver and
+///   appends them to a columnar binary file at the end of each time step
+
+class ConvergenceTrace
+{
+  public:
+    ConvergenceTrace(Mesh * myMesh,YAML::Node * myInput);
+    ~ConvergenceTrace();
+
+    // Levels match the codes used in the iterates output
+    enum Level {levelELOT = 1,levelMGLOQD = 2,levelMGHOT = 3};
+    enum Decision {iterate = 0,converged = 1,reset = 2,skipped = 3};
+
+    bool enabled = false;
+    string fileName = "convergence.qct";
+    void record(int level,int iteration,vector<double> residuals,\
+      vector<double> targets,double eddingtonResidual,double seconds,\
+      int decision);
+    void beginSolve();
+    void endSolve(int level);
+    void flush();
+    void checkOptionalParams();
+
+  private:
+    Mesh * mesh;
+    YAML::Node * input;
+    ofstream file;
+    int rank = 0;
+    bool restarting = false;
+    double solveStart = 0.0,pendingKrylov[4] = {0.0,0.0,0.0,0.0};
+    vector<int> step,level,iteration,krylovIterations,decision;
+    vector<double> time,fluxResidual,tempResidual,dnpResidual,\
+      eddingtonResidual,fluxTarget,tempTarget,seconds;
+    void writeHeader();
+    void writeColumn(const vector<int> & column);
+    void writeColumn(const vector<double> & column);
+};
+
+//==============================================================================
+
+#endif
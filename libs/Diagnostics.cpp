@@ -0,0 +1,392 @@
+// File: Diagnostics.cpp     
+// Purpose: Compute integral and peak quantities of the solution during a 
+//   transient and write them as time series
+// Date: October 18, 2026
+
+#include "Diagnostics.h"
+#include "HeatTransfer.h"
+#include "MultiGroupDNP.h"
+#include "GreyGroupQD.h"
+
+using namespace std;
+
+//==============================================================================
+/// Diagnostics class object constructor
+///
+/// @param [in] myMesh mesh object 
+/// @param [in] myMats materials object 
+/// @param [in] myInput input object 
+/// @param [in] myMPQD MultiPhysicsCoupledQD object 
+Diagnostics::Diagnostics(Mesh * myMesh,\
+    Materials * myMats,\
+    YAML::Node * myInput,\
+    MultiPhysicsCoupledQD * myMPQD)
+{
+
+  int initialized = 0;
+
+  mesh = myMesh;
+  mats = myMats;
+  input = myInput;
+  mpqd = myMPQD;
+
+  // Every rank holds the full solution, so only rank 0 writes the series
+  MPI_Initialized(&initialized);
+  if (initialized)
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+
+  // Get volume of each cell
+  volume.setZero(mesh->nZ,mesh->nR);
+  for (int iZ = 0; iZ < volume.rows(); iZ++)
+    for (int iR = 0; iR < volume.cols(); iR++)
+      volume(iZ,iR) = mesh->getGeoParams(iR,iZ)[0];
+
+  checkOptionalParams();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Diagnostics class object destructor
+///
+Diagnostics::~Diagnostics()
+{
+
+  scalarFile.close();
+  axialFile.close();
+  radialFile.close();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Compute requested quantities at the present time and append them to the
+/// time series files
+///
+void Diagnostics::evaluate()
+{
+
+  double time = mesh->ts[mesh->state];
+  vector<double> scalars;
+  Eigen::MatrixXd powerDensity;
+  Eigen::VectorXd inventory;
+
+  if (quantities.empty() or mesh->state % everyNSteps != 0 or rank != 0)
+    return;
+
+  if (not scalarFile.is_open())
+    openFiles();
+
+  powerDensity = calcPowerDensity();
+
+  for (int iQuantity = 0; iQuantity < quantities.size(); iQuantity++)
+  {
+    if (quantities[iQuantity] == "totalPower")
+      scalars.push_back(calcTotalPower(powerDensity));
+    else if (quantities[iQuantity] == "peakTemperature")
+      scalars.push_back(calcPeakTemperature());
+    else if (quantities[iQuantity] == "outletTemperature")
+      scalars.push_back(calcOutletTemperature());
+    else if (quantities[iQuantity] == "reactivity")
+      scalars.push_back(calcReactivity());
+    else if (quantities[iQuantity] == "precursorInventory")
+    {
+      inventory = calcPrecursorInventory();
+      scalars.insert(scalars.end(),inventory.data(),\
+          inventory.data() + inventory.size());
+    }
+  }
+
+  if (scalars.size() > 0)
+    writeRow(scalarFile,time,\
+        Eigen::Map<Eigen::VectorXd>(scalars.data(),scalars.size()));
+
+  if (requested("axialPower"))
+    writeRow(axialFile,time,calcAxialPower(powerDensity));
+
+  if (requested("radialPower"))
+    writeRow(radialFile,time,calcRadialPower(powerDensity));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate the fission power in each cell
+///
+/// @return power in each cell
+Eigen::MatrixXd Diagnostics::calcPowerDensity()
+{
+
+  Eigen::MatrixXd power;
+
+  power.setZero(mesh->nZ,mesh->nR);
+  for (int iZ = 0; iZ < mesh->nZ; iZ++)
+    for (int iR = 0; iR < mesh->nR; iR++)
+      power(iZ,iR) = mats->omega(iZ,iR)*mats->oneGroupXS->sigF(iZ,iR)\
+                     *mpqd->ggqd->sFlux(iZ,iR)*volume(iZ,iR);
+
+  return power;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate total fission power
+///
+/// @param [in] powerDensity power in each cell
+/// @return total power
+double Diagnostics::calcTotalPower(Eigen::MatrixXd powerDensity)
+{
+
+  return powerDensity.sum();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate the peak temperature in the core
+///
+/// @return maximum cell temperature
+double Diagnostics::calcPeakTemperature()
+{
+
+  return mpqd->heat->temp.maxCoeff();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate the flow-area weighted temperature at the core outlet
+///
+/// @return average outlet temperature
+double Diagnostics::calcOutletTemperature()
+{
+
+  double area,totalArea = 0.0,weightedTemp = 0.0;
+
+  for (int iR = 0; iR < mesh->nR; iR++)
+  {
+    area = mesh->getGeoParams(iR,mesh->nZ-1)[4];
+    weightedTemp += area*mpqd->heat->outletTemp(iR);
+    totalArea += area;
+  }
+
+  return weightedTemp/totalArea;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Estimate reactivity from the grey group neutron balance. Production is
+/// the prompt fission source scaled by the initial eigenvalue plus the 
+/// delayed source of precursors in the core; losses are absorption and 
+/// leakage through the outer boundaries. The estimate is zero at the initial 
+/// critical state.
+///
+/// @return (production - losses)/production
+double Diagnostics::calcReactivity()
+{
+
+  double production = 0.0,losses = 0.0,keff = mats->oneGroupXS->keff;
+  vector<double> geoParams;
+  GreyGroupQD * ggqd = mpqd->ggqd;
+  CollapsedCrossSections * xs = mats->oneGroupXS;
+
+  for (int iZ = 0; iZ < mesh->nZ; iZ++)
+  {
+    for (int iR = 0; iR < mesh->nR; iR++)
+    {
+      production += xs->qdFluxCoeff(iZ,iR)*ggqd->sFlux(iZ,iR)\
+                    *volume(iZ,iR)/keff;
+      for (int iDNP = 0; iDNP < mpqd->mgdnp->DNPs.size(); iDNP++)
+        production += mpqd->mgdnp->DNPs[iDNP]->lambda\
+                      *mpqd->mgdnp->DNPs[iDNP]->dnpConc(iZ,iR)*volume(iZ,iR);
+      losses += (xs->sigT(iZ,iR) - xs->sigS(iZ,iR))*ggqd->sFlux(iZ,iR)\
+                *volume(iZ,iR);
+    }
+  }
+
+  // Leakage through outer radial boundary
+  for (int iZ = 0; iZ < mesh->nZ; iZ++)
+  {
+    geoParams = mesh->getGeoParams(mesh->nR-1,iZ);
+    losses += ggqd->currentR(iZ,mesh->nR)*geoParams[2];
+  }
+
+  // Leakage through top and bottom boundaries
+  for (int iR = 0; iR < mesh->nR; iR++)
+  {
+    geoParams = mesh->getGeoParams(iR,0);
+    losses -= ggqd->currentZ(0,iR)*geoParams[3];
+    geoParams = mesh->getGeoParams(iR,mesh->nZ-1);
+    losses += ggqd->currentZ(mesh->nZ,iR)*geoParams[4];
+  }
+
+  return (production - losses)/production;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate the number of precursors of each group in the core and 
+/// recirculation loop
+///
+/// @return inventory of each precursor group
+Eigen::VectorXd Diagnostics::calcPrecursorInventory()
+{
+
+  MultiGroupDNP * mgdnp = mpqd->mgdnp;
+  Eigen::VectorXd inventory;
+
+  inventory.setZero(mgdnp->DNPs.size());
+  for (int iDNP = 0; iDNP < mgdnp->DNPs.size(); iDNP++)
+  {
+    inventory(iDNP) = mgdnp->DNPs[iDNP]->dnpConc.cwiseProduct(volume).sum();
+    for (int iZ = 0; iZ < mgdnp->DNPs[iDNP]->recircConc.rows(); iZ++)
+      for (int iR = 0; iR < mgdnp->DNPs[iDNP]->recircConc.cols(); iR++)
+        inventory(iDNP) += mgdnp->DNPs[iDNP]->recircConc(iZ,iR)\
+                           *mesh->getRecircGeoParams(iR,iZ)[0];
+  }
+
+  return inventory;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate power in each axial level
+///
+/// @param [in] powerDensity power in each cell
+/// @return power summed over each row of cells
+Eigen::VectorXd Diagnostics::calcAxialPower(Eigen::MatrixXd powerDensity)
+{
+
+  return powerDensity.rowwise().sum();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate power in each radial ring
+///
+/// @param [in] powerDensity power in each cell
+/// @return power summed over each column of cells
+Eigen::VectorXd Diagnostics::calcRadialPower(Eigen::MatrixXd powerDensity)
+{
+
+  return powerDensity.colwise().sum().transpose();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Check whether a quantity was requested
+///
+/// @param [in] quantity name of quantity
+/// @return whether quantity is in quantities 
+bool Diagnostics::requested(string quantity)
+{
+
+  return find(quantities.begin(),quantities.end(),quantity)!=quantities.end();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Open time series files and write their headers. A restarted run appends
+/// to the files of the run it continues.
+///
+void Diagnostics::openFiles()
+{
+
+  string dir = mesh->output->getOutputPath(outputDir,true);
+  ios::openmode mode = restarting ? ios::out | ios::app : ios::out;
+
+  mesh->output->makePath(dir);
+
+  scalarFile.open(dir + "diagnostics.csv",mode);
+  if (not restarting)
+  {
+    scalarFile << "time";
+    for (int iQuantity = 0; iQuantity < quantities.size(); iQuantity++)
+    {
+      if (quantities[iQuantity] == "precursorInventory")
+      {
+        for (int iDNP = 0; iDNP < mpqd->mgdnp->DNPs.size(); iDNP++)
+          scalarFile << ",precursorInventory_" << iDNP;
+      }
+      else if (quantities[iQuantity] != "axialPower" and \
+          quantities[iQuantity] != "radialPower")
+        scalarFile << "," << quantities[iQuantity];
+    }
+    scalarFile << endl;
+  }
+
+  if (requested("axialPower"))
+  {
+    axialFile.open(dir + "axial_power.csv",mode);
+    if (not restarting)
+      writeRow(axialFile,nan(""),\
+          Eigen::Map<Eigen::VectorXd>(mesh->zCornerCent.memptr(),mesh->nZ));
+  }
+
+  if (requested("radialPower"))
+  {
+    radialFile.open(dir + "radial_power.csv",mode);
+    if (not restarting)
+      writeRow(radialFile,nan(""),\
+          Eigen::Map<Eigen::VectorXd>(mesh->rCornerCent.memptr(),mesh->nR));
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Append a row to a time series file
+///
+/// @param [in] file time series file
+/// @param [in] time time of row
+/// @param [in] values values in row
+void Diagnostics::writeRow(ofstream & file,double time,Eigen::VectorXd values)
+{
+
+  file << setprecision(10) << time;
+  for (int iValue = 0; iValue < values.size(); iValue++)
+    file << "," << values(iValue);
+  file << endl;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read in optional parameters that might be specified in the input 
+///
+void Diagnostics::checkOptionalParams()
+{
+
+  vector<string> known = {"totalPower","peakTemperature","outletTemperature",\
+    "reactivity","precursorInventory","axialPower","radialPower"};
+
+  // Check for requested diagnostic quantities
+  if ((*input)["parameters"]["diagnostics"])
+    quantities=(*input)["parameters"]["diagnostics"].as<vector<string>>();
+
+  for (int iQuantity = 0; iQuantity < quantities.size(); iQuantity++)
+  {
+    if (find(known.begin(),known.end(),quantities[iQuantity]) == known.end())
+    {
+      cout << "Unknown diagnostic " << quantities[iQuantity] << " ignored.";
+      cout << endl;
+    }
+  }
+
+  // Check for interval between evaluations
+  if ((*input)["parameters"]["diagnosticsEveryNSteps"])
+    everyNSteps=(*input)["parameters"]["diagnosticsEveryNSteps"].as<int>();
+
+  // A run restarted from a checkpoint continues the existing series
+  if ((*input)["parameters"]["restartFile"])
+    restarting = true;
+
+};
+//==============================================================================
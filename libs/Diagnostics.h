@@ -0,0 +1,57 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include "Mesh.h"
+#include "Materials.h"
+#include "MultiPhysicsCoupledQD.h"
+#include "WriteData.h"
+
+using namespace std;
+
+//==============================================================================
+//! Computes integral and peak quantities of the multiphysics solution in situ
+///   and appends them to compact time series files
+
+class Diagnostics
+{
+  public:
+    Diagnostics(Mesh * myMesh,\
+        Materials * myMats,\
+        YAML::Node * myInput,\
+        MultiPhysicsCoupledQD * myMPQD);
+    ~Diagnostics();
+
+    // Requested quantities. Any of totalPower, peakTemperature, 
+    // outletTemperature, reactivity, precursorInventory, axialPower, and
+    // radialPower.
+    vector<string> quantities;
+    int everyNSteps = 1;
+    string outputDir = "Diagnostics/";
+    void evaluate();
+    Eigen::MatrixXd calcPowerDensity();
+    double calcTotalPower(Eigen::MatrixXd powerDensity);
+    double calcPeakTemperature();
+    double calcOutletTemperature();
+    double calcReactivity();
+    Eigen::VectorXd calcPrecursorInventory();
+    Eigen::VectorXd calcAxialPower(Eigen::MatrixXd powerDensity);
+    Eigen::VectorXd calcRadialPower(Eigen::MatrixXd powerDensity);
+    void checkOptionalParams();
+
+  private:
+    Mesh * mesh;
+    Materials * mats;
+    YAML::Node * input;
+    MultiPhysicsCoupledQD * mpqd;
+    Eigen::MatrixXd volume;
+    ofstream scalarFile,axialFile,radialFile;
+    int rank = 0;
+    bool restarting = false;
+    bool requested(string quantity);
+    void openFiles();
+    void writeRow(ofstream & file,double time,Eigen::VectorXd values);
+};
+
+//==============================================================================
+
+#endif
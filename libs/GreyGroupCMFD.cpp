@@ -0,0 +1,188 @@
+// File: GreyGroupCMFD.cpp
+// Purpose: Flux-weighted coarse rebalance of the grey group flux between
+//   cycles of iterative ELOT solves
+// Date: October 18, 2026
+
+#include "GreyGroupCMFD.h"
+#include "GreyGroupQD.h"
+#include "Profiler.h"
+#include "Logger.h"
+
+using namespace std;
+
+//==============================================================================
+/// GreyGroupCMFD class object constructor
+///
+/// @param [in] myMesh mesh object
+/// @param [in] myInput input object
+/// @param [in] myGGQD grey group quasidiffusion object
+/// @param [in] nSystemUnknowns size of the ELOT system
+GreyGroupCMFD::GreyGroupCMFD(Mesh * myMesh,YAML::Node * myInput,\
+  GreyGroupQD * myGGQD,int nSystemUnknowns)
+{
+
+  mesh = myMesh;
+  input = myInput;
+  ggqd = myGGQD;
+
+  checkOptionalParams();
+
+  nCoarseZ = (mesh->dzsCorner.size() + factorZ - 1)/factorZ;
+  nCoarseR = (mesh->drsCorner.size() + factorR - 1)/factorR;
+  nCoarse = nCoarseZ*nCoarseR;
+
+  if (enabled)
+  {
+    buildTransfers(nSystemUnknowns);
+    mesh->logger->info("ELOT") << "Coarse rebalance on " << nCoarseZ \
+      << " x " << nCoarseR << " coarse cells every " << cycleIterations \
+      << " Krylov iterations." << endl;
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Index of the coarse cell holding a fine cell
+///
+/// @param [in] iR radial index of fine cell
+/// @param [in] iZ axial index of fine cell
+/// @return index of the coarse cell
+int GreyGroupCMFD::coarseIndex(int iR,int iZ)
+{
+
+  return (iR/factorR)*nCoarseZ + iZ/factorZ;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Build the restriction, which sums the zeroth moment equations of the fine
+/// cells in each coarse cell, and the prolongation, which carries a coarse
+/// factor to the center and face fluxes of those fine cells. Faces between
+/// two coarse cells take the mean of their factors.
+///
+/// @param [in] nSystemUnknowns size of the ELOT system
+void GreyGroupCMFD::buildTransfers(int nSystemUnknowns)
+{
+
+  int iEq = ggqd->indexOffset,iCoarse;
+  int nZ = mesh->dzsCorner.size(),nR = mesh->drsCorner.size();
+  vector<int> indices;
+  vector<Eigen::Triplet<double>> restrictEntries,prolongEntries;
+  Eigen::VectorXd weightSum;
+
+  // Rows are visited in the order GreyGroupSolver::formLinearSystem writes
+  // them. The zeroth moment equation is the first row of each cell, followed
+  // by the south and east faces, then the north and west boundaries.
+  for (int iR = 0; iR < nR; iR++)
+  {
+    for (int iZ = 0; iZ < nZ; iZ++)
+    {
+      iCoarse = coarseIndex(iR,iZ);
+      indices = mesh->getQDCellIndices(iR,iZ);
+
+      restrictEntries.push_back(Eigen::Triplet<double>(iCoarse,iEq,1.0));
+      iEq = iEq + 3 + (iZ == 0) + (iR == 0);
+
+      // Center and west, east, north, and south face fluxes
+      for (int iIndex = 0; iIndex < 5; iIndex++)
+        prolongEntries.push_back(Eigen::Triplet<double>(indices[iIndex]\
+          + ggqd->indexOffset,iCoarse,1.0));
+    }
+  }
+
+  restriction.resize(nCoarse,nSystemUnknowns);
+  restriction.setFromTriplets(restrictEntries.begin(),restrictEntries.end());
+
+  prolongation.resize(nSystemUnknowns,nCoarse);
+  prolongation.setFromTriplets(prolongEntries.begin(),prolongEntries.end());
+
+  weightSum = prolongation*Eigen::VectorXd::Ones(nCoarse);
+  for (int iCol = 0; iCol < prolongation.outerSize(); iCol++)
+    for (Eigen::SparseMatrix<double>::InnerIterator it(prolongation,iCol); \
+      it; ++it)
+      it.valueRef() /= weightSum(it.row());
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Rescale the grey group flux of an ELOT iterate so that it satisfies
+/// neutron balance over every coarse cell. Temperatures and precursor
+/// concentrations are held at their values in the iterate.
+///
+/// @param [in] A assembled ELOT matrix
+/// @param [in] b assembled ELOT right hand side
+/// @param [in,out] x iterate to correct
+/// @return whether a correction was applied
+bool GreyGroupCMFD::accelerate(\
+  const Eigen::SparseMatrix<double,Eigen::RowMajor> & A,\
+  const Eigen::VectorXd & b,Eigen::VectorXd & x)
+{
+
+  int offset = ggqd->indexOffset,nFlux = ggqd->nUnknowns;
+  Eigen::VectorXd shape = Eigen::VectorXd::Zero(x.size()),other = x;
+  Eigen::VectorXd coarseB,factors;
+  Eigen::SparseMatrix<double,Eigen::RowMajor> coarseRows;
+  Eigen::SparseMatrix<double> weighted,coarseA;
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+
+  ScopedTimer timer(mesh->profiler,"CMFD");
+
+  // An iterate without a positive flux has no shape to scale
+  if (x.segment(offset,nFlux).minCoeff() <= 0.0)
+    return false;
+
+  shape.segment(offset,nFlux) = x.segment(offset,nFlux);
+  other.segment(offset,nFlux).setZero();
+
+  // Coupling coefficients between coarse cells are the fine coefficients
+  // weighted by the flux shape, so the factors are all one when the iterate
+  // already satisfies the summed balance equations
+  coarseRows = restriction*A;
+  weighted = shape.asDiagonal()*prolongation;
+  coarseA = coarseRows*weighted;
+  coarseB = restriction*b - coarseRows*other;
+
+  solver.compute(coarseA);
+  if (solver.info() == Eigen::Success)
+    factors = solver.solve(coarseB);
+
+  if (solver.info() != Eigen::Success or factors.minCoeff() <= 0.0)
+  {
+    mesh->logger->warning("ELOT") << "Coarse rebalance failed; keeping the " \
+      << "uncorrected iterate." << endl;
+    return false;
+  }
+
+  x.segment(offset,nFlux) = x.segment(offset,nFlux)\
+    .cwiseProduct((prolongation*factors).segment(offset,nFlux));
+  mesh->profiler->count("cmfdCorrections");
+
+  return true;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read coarsening parameters from the input file
+///
+void GreyGroupCMFD::checkOptionalParams()
+{
+
+  if ((*input)["parameters"]["cmfdCoarsenZ"])
+    factorZ = max(1,(*input)["parameters"]["cmfdCoarsenZ"].as<int>());
+
+  if ((*input)["parameters"]["cmfdCoarsenR"])
+    factorR = max(1,(*input)["parameters"]["cmfdCoarsenR"].as<int>());
+
+  // Krylov iterations between rebalances
+  if ((*input)["parameters"]["cmfdCycleIterations"])
+    cycleIterations = max(1,\
+      (*input)["parameters"]["cmfdCycleIterations"].as<int>());
+
+  enabled = (factorZ > 1 or factorR > 1);
+
+};
+//==============================================================================
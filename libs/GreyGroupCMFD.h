@@ -0,0 +1,45 @@
+#ifndef GREYGROUPCMFD_H
+#define GREYGROUPCMFD_H
+
+#include "Mesh.h"
+
+using namespace std;
+
+class GreyGroupQD;
+
+//==============================================================================
+//! Flux-weighted coarse rebalance of the grey group flux in the ELOT 
+///   system. Blocks of fine cells are aggregated into coarse cells, and one
+///   balance equation per coarse cell is solved for a factor that scales the
+///   fine flux shape of the current iterate. The coarse equations are the 
+///   fine zeroth moment equations summed over each coarse cell and applied
+///   to the scaled shape; there are no CMFD current correction factors. The
+///   rebalance is applied between restarted cycles of the Krylov solve, and
+///   its factors are all one once the fine system is solved.
+
+class GreyGroupCMFD
+{
+  public:
+    GreyGroupCMFD(Mesh * myMesh,YAML::Node * myInput,GreyGroupQD * myGGQD,\
+      int nSystemUnknowns);
+
+    bool enabled = false;
+    int factorZ = 1,factorR = 1,nCoarseZ,nCoarseR,nCoarse;
+    int cycleIterations = 20;
+    bool accelerate(const Eigen::SparseMatrix<double,Eigen::RowMajor> & A,\
+      const Eigen::VectorXd & b,Eigen::VectorXd & x);
+    void checkOptionalParams();
+
+  private:
+    Mesh * mesh;
+    YAML::Node * input;
+    GreyGroupQD * ggqd;
+    Eigen::SparseMatrix<double,Eigen::RowMajor> restriction;
+    Eigen::SparseMatrix<double> prolongation;
+    void buildTransfers(int nSystemUnknowns);
+    int coarseIndex(int iR,int iZ);
+};
+
+//==============================================================================
+
+#endif
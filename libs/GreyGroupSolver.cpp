@@ -2658,6 +2658,10 @@ void GreyGroupSolver::formSteadyStateLinearSystem_p()
 {
 
   int iEq = GGQD->indexOffset;
+  OwnedRows rows;
+
+  // Only assemble the rows this rank owns
+  getOwnedRows(&(MPQD->A_p),&rows);
   //Atemp.resize(nUnknowns,A->cols());
 
   // loop over spatial mesh
@@ -2667,19 +2671,22 @@ void GreyGroupSolver::formSteadyStateLinearSystem_p()
     {
 
       // apply zeroth moment equation
-      assertSteadyStateZerothMoment_p(iR,iZ,iEq);
+      if (rows.contains(iEq))
+        assertSteadyStateZerothMoment_p(iR,iZ,iEq);
       iEq = iEq + 1;
 
       // south face
       if (iZ == mesh->dzsCorner.size()-1)
       {
         // if on the boundary, assert boundary conditions
-        assertSteadyStateSBC_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          assertSteadyStateSBC_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } else
       {
         // otherwise assert first moment balance on south face
-        applySteadyStateAxialBoundary_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          applySteadyStateAxialBoundary_p(iR,iZ,iEq);
         iEq = iEq + 1;
       }
 
@@ -2687,12 +2694,14 @@ void GreyGroupSolver::formSteadyStateLinearSystem_p()
       if (iR == mesh->drsCorner.size()-1)
       {
         // if on the boundary, assert boundary conditions
-        assertSteadyStateEBC_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          assertSteadyStateEBC_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } else
       {
         // otherwise assert first moment balance on north face
-        applySteadyStateRadialBoundary_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          applySteadyStateRadialBoundary_p(iR,iZ,iEq);
         iEq = iEq + 1;
       }
 
@@ -2700,7 +2709,8 @@ void GreyGroupSolver::formSteadyStateLinearSystem_p()
       if (iZ == 0)
       {
         // if on the boundary, assert boundary conditions
-        assertSteadyStateNBC_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          assertSteadyStateNBC_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } 
 
@@ -2708,7 +2718,8 @@ void GreyGroupSolver::formSteadyStateLinearSystem_p()
       if (iR == 0)
       {
         // if on the boundary, assert boundary conditions
-        assertSteadyStateWBC_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          assertSteadyStateWBC_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } 
 
@@ -2723,6 +2734,10 @@ void GreyGroupSolver::formSteadyStateLinearSystem_p()
 int GreyGroupSolver::formSteadyStateBackCalcSystem_p()	      
 {
   int iEq = GGQD->indexOffset;
+  OwnedRows rows;
+
+  // Only assemble the rows this rank owns
+  getOwnedRows(&C_p,&rows);
   PetscErrorCode ierr;
 
   // Reset linear system
@@ -2736,17 +2751,20 @@ int GreyGroupSolver::formSteadyStateBackCalcSystem_p()
     {
 
       // south face
-      calcSteadyStateSouthCurrent_p(iR,iZ,iEq);
+      if (rows.contains(iEq))
+        calcSteadyStateSouthCurrent_p(iR,iZ,iEq);
       iEq = iEq + 1;
 
       // east face
-      calcSteadyStateEastCurrent_p(iR,iZ,iEq);
+      if (rows.contains(iEq))
+        calcSteadyStateEastCurrent_p(iR,iZ,iEq);
       iEq = iEq + 1;
 
       // north face
       if (iZ == 0)
       {
-        calcSteadyStateNorthCurrent_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          calcSteadyStateNorthCurrent_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } 
 
@@ -2754,7 +2772,8 @@ int GreyGroupSolver::formSteadyStateBackCalcSystem_p()
       if (iR == 0)
       {
         // if on the boundary, assert boundary conditions
-        calcSteadyStateWestCurrent_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          calcSteadyStateWestCurrent_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } 
 
@@ -3810,6 +3829,10 @@ void GreyGroupSolver::formLinearSystem_p()
 {
 
   int iEq = GGQD->indexOffset;
+  OwnedRows rows;
+
+  // Only assemble the rows this rank owns
+  getOwnedRows(&(MPQD->A_p),&rows);
 
   // loop over spatial mesh
   for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
@@ -3818,19 +3841,22 @@ void GreyGroupSolver::formLinearSystem_p()
     {
 
       // apply zeroth moment equation
-      assertZerothMoment_p(iR,iZ,iEq);
+      if (rows.contains(iEq))
+        assertZerothMoment_p(iR,iZ,iEq);
       iEq = iEq + 1;
 
       // south face
       if (iZ == mesh->dzsCorner.size()-1)
       {
         // if on the boundary, assert boundary conditions
-        assertSBC_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          assertSBC_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } else
       {
         // otherwise assert first moment balance on south face
-        applyAxialBoundary_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          applyAxialBoundary_p(iR,iZ,iEq);
         iEq = iEq + 1;
       }
 
@@ -3838,12 +3864,14 @@ void GreyGroupSolver::formLinearSystem_p()
       if (iR == mesh->drsCorner.size()-1)
       {
         // if on the boundary, assert boundary conditions
-        assertEBC_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          assertEBC_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } else
       {
         // otherwise assert first moment balance on north face
-        applyRadialBoundary_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          applyRadialBoundary_p(iR,iZ,iEq);
         iEq = iEq + 1;
       }
 
@@ -3851,7 +3879,8 @@ void GreyGroupSolver::formLinearSystem_p()
       if (iZ == 0)
       {
         // if on the boundary, assert boundary conditions
-        assertNBC_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          assertNBC_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } 
 
@@ -3859,7 +3888,8 @@ void GreyGroupSolver::formLinearSystem_p()
       if (iR == 0)
       {
         // if on the boundary, assert boundary conditions
-        assertWBC_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          assertWBC_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } 
 
@@ -4650,6 +4680,10 @@ int GreyGroupSolver::assertEGoldinP1BC_p(int iR,int iZ,int iEq)
 int GreyGroupSolver::formBackCalcSystem_p()	      
 {
   int iEq = GGQD->indexOffset;
+  OwnedRows rows;
+
+  // Only assemble the rows this rank owns
+  getOwnedRows(&C_p,&rows);
   PetscErrorCode ierr;
 
   // Reset linear system
@@ -4663,17 +4697,20 @@ int GreyGroupSolver::formBackCalcSystem_p()
     {
 
       // south face
-      calcSouthCurrent_p(iR,iZ,iEq);
+      if (rows.contains(iEq))
+        calcSouthCurrent_p(iR,iZ,iEq);
       iEq = iEq + 1;
 
       // east face
-      calcEastCurrent_p(iR,iZ,iEq);
+      if (rows.contains(iEq))
+        calcEastCurrent_p(iR,iZ,iEq);
       iEq = iEq + 1;
 
       // north face
       if (iZ == 0)
       {
-        calcNorthCurrent_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          calcNorthCurrent_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } 
 
@@ -4681,7 +4718,8 @@ int GreyGroupSolver::formBackCalcSystem_p()
       if (iR == 0)
       {
         // if on the boundary, assert boundary conditions
-        calcWestCurrent_p(iR,iZ,iEq);
+        if (rows.contains(iEq))
+          calcWestCurrent_p(iR,iZ,iEq);
         iEq = iEq + 1;
       } 
 
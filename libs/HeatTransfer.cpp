@@ -4,6 +4,7 @@
 
 #include "HeatTransfer.h"
 #include "MultiPhysicsCoupledQD.h"
+#include "Scheduler.h"
 
 using namespace std;
 
@@ -59,8 +60,7 @@ void HeatTransfer::buildLinearSystem()
   vector<double> gParams;
 
   updateBoundaryConditions();
-  calcDiracs();
-  calcFluxes();
+  calcAdvectionRate();
 
   // Calculate core-average gamma deposition term
   if (modIrradiation == axial)
@@ -79,7 +79,8 @@ void HeatTransfer::buildLinearSystem()
   Atemp.setZero();
   
   #pragma omp parallel for private(myIndex,sIndex,nIndex,wIndex,eIndex,\
-    gParams,cCoeff,coeff,harmonicAvg,iEq,iEqTemp)
+    gParams,cCoeff,coeff,harmonicAvg,iEq,iEqTemp) \
+    num_threads(mesh->scheduler->threads(Scheduler::assembly))
   for (int iZ = 0; iZ < temp.rows(); iZ++)
   {
 
@@ -192,7 +193,7 @@ void HeatTransfer::buildLinearSystem()
       
 
       // Advection term
-      mpqd->b(iEq) += (mesh->dt/mesh->dzsCorner(iZ))*(flux(iZ,iR)-flux(iZ+1,iR));
+      mpqd->b(iEq) += mesh->dt*advRate(iZ,iR);
 
       // Iterate equation count
       //iEq = iEq + 1;
@@ -236,7 +237,8 @@ void HeatTransfer::buildSteadyStateLinearSystem()
   Atemp.setZero();
   
   #pragma omp parallel for private(myIndex,sIndex,nIndex,wIndex,eIndex,\
-    upwindIndex,gParams,cCoeff,coeff,keff,neutronFlux,harmonicAvg,iEq,iEqTemp)
+    upwindIndex,gParams,cCoeff,coeff,keff,neutronFlux,harmonicAvg,iEq,iEqTemp) \
+    num_threads(mesh->scheduler->threads(Scheduler::assembly))
   for (int iZ = 0; iZ < temp.rows(); iZ++)
   {
 
@@ -703,9 +705,19 @@ void HeatTransfer::calcImplicitFluxes()
 
 
 //==============================================================================
-/// Calculate energy flux 
+/// Calculate energy flux over the current time step
 ///
 void HeatTransfer::calcFluxes()
+{
+  calcFluxes(mesh->dt);
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate energy flux 
+///
+/// @param [in] advDt time step the advection update is taken over
+void HeatTransfer::calcFluxes(double advDt)
 {
 
   double tdc; // shorthand for temp*density*specific heat 
@@ -718,7 +730,7 @@ void HeatTransfer::calcFluxes()
       // Handle iZ = 0 case
       tdc = inletVelocity(iR)*inletDensity(iR)*inletcP(iR);
       flux(0,iR) = tdc*inletTemp(1,iR)\
-                   + 0.5*abs(tdc)*(1-abs(tdc*mesh->dt/mesh->dzsCorner(0)))\
+                   + 0.5*abs(tdc)*(1-abs(tdc*advDt/mesh->dzsCorner(0)))\
                    *dirac(0,iR);
 
       // Handle all other cases
@@ -727,7 +739,7 @@ void HeatTransfer::calcFluxes()
         tdc = mats->flowVelocity(iZ-1,iR)*mats->density(iZ-1,iR)\
               *mats->cP(iZ-1,iR);
         flux(iZ,iR) = tdc*temp(iZ-1,iR)\
-                      + 0.5*abs(tdc)*(1-abs(tdc*mesh->dt/mesh->dzsCorner(iZ-1)))\
+                      + 0.5*abs(tdc)*(1-abs(tdc*advDt/mesh->dzsCorner(iZ-1)))\
                       *dirac(iZ,iR);
       }
 
@@ -745,13 +757,13 @@ void HeatTransfer::calcFluxes()
         tdc = mats->flowVelocity(iZ,iR)*mats->density(iZ,iR)\
               *mats->cP(iZ,iR);
         flux(iZ,iR) = tdc*temp(iZ,iR)\
-                      + 0.5*abs(tdc)*(1-abs(tdc*mesh->dt/mesh->dzsCorner(iZ)))*dirac(iZ,iR);
+                      + 0.5*abs(tdc)*(1-abs(tdc*advDt/mesh->dzsCorner(iZ)))*dirac(iZ,iR);
       }
 
       // Handle iZ = nZ case
       tdc = inletVelocity(iR)*inletDensity(iR)*inletcP(iR);
       flux(lastFluxIndex,iR) = tdc*inletTemp(0,iR)\
-                               + 0.5*abs(tdc)*(1-abs(tdc*mesh->dt/mesh->dzsCorner(lastFluxIndex-1)))\
+                               + 0.5*abs(tdc)*(1-abs(tdc*advDt/mesh->dzsCorner(lastFluxIndex-1)))\
                                *dirac(lastFluxIndex,iR);
 
     }
@@ -760,6 +772,94 @@ void HeatTransfer::calcFluxes()
 };
 //==============================================================================
 
+//==============================================================================
+/// Calculate the rate of change of energy density due to axial advection
+///
+/// Over a macro step of advMacroSteps time steps, the explicit flux-limited
+/// advection update is subcycled on a scratch copy of the temperature field
+/// and the face fluxes are integrated in time, so energy leaving one cell
+/// always enters its neighbor. The time-averaged rate is reused on each step
+/// of the macro step.
+void HeatTransfer::calcAdvectionRate()
+{
+
+  Eigen::MatrixXd tempSave,advIntegral;
+  double macroDt,subDt,increment;
+  int nSubcycles;
+
+  // Reuse the advection rate if still within the current macro step
+  if (advMacroSteps > 1 and advUpdateState >= 0\
+      and mesh->state >= advUpdateState\
+      and mesh->state - advUpdateState < advMacroSteps\
+      and advRate.rows() == temp.rows())
+    return;
+
+  macroDt = advMacroSteps*mesh->dt;
+  nSubcycles = calcNumSubcycles(macroDt);
+  subDt = macroDt/nSubcycles;
+
+  tempSave = temp;
+  advIntegral.setZero(temp.rows(),temp.cols());
+
+  for (int iSub = 0; iSub < nSubcycles; iSub++)
+  {
+    updateBoundaryConditions();
+    calcDiracs();
+    calcFluxes(subDt);
+
+    for (int iZ = 0; iZ < temp.rows(); iZ++)
+    {
+      for (int iR = 0; iR < temp.cols(); iR++)
+      {
+        increment = (subDt/mesh->dzsCorner(iZ))*(flux(iZ,iR)-flux(iZ+1,iR));
+        advIntegral(iZ,iR) += increment;
+
+        // Advance scratch temperature for the next subcycle
+        if (nSubcycles > 1)
+          temp(iZ,iR) += increment/(mats->density(iZ,iR)*mats->cP(iZ,iR));
+      }
+    }
+  }
+
+  // Restore temperature at the beginning of the step
+  temp = tempSave;
+  updateBoundaryConditions();
+
+  advRate = advIntegral/macroDt;
+  advUpdateState = mesh->state;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Determine the number of advection subcycles to take over a macro step
+///
+/// @param [in] macroDt length of the macro step
+/// @param [out] nSubcycles number of subcycles to take
+int HeatTransfer::calcNumSubcycles(double macroDt)
+{
+
+  double courant,maxCourant = 0.0;
+  int nSubcycles = advSubcycles;
+
+  if (advCourant > 0.0)
+  {
+    for (int iZ = 0; iZ < temp.rows(); iZ++)
+    {
+      for (int iR = 0; iR < temp.cols(); iR++)
+      {
+        courant = abs(mats->flowVelocity(iZ,iR))*macroDt/mesh->dzsCorner(iZ);
+        maxCourant = max(maxCourant,courant);
+      }
+    }
+    nSubcycles = max(nSubcycles,(int) ceil(maxCourant/advCourant));
+  }
+
+  return max(nSubcycles,1);
+
+};
+//==============================================================================
+
 //==============================================================================
 /// Calculate theta for use in flux limiting framework 
 ///
@@ -961,9 +1061,13 @@ int HeatTransfer::setTemp()
   PetscErrorCode ierr;
   PetscScalar value;
   PetscInt index;
+  OwnedRows rows;
 
   if (mesh->petsc)
   {
+    // Each rank only adds the entries it owns
+    getOwnedRows(&(mpqd->xPast_p),&rows);
+
     for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
     {
       for (int iZ = 0; iZ < mesh->dzsCorner.size(); iZ++)
@@ -971,7 +1075,11 @@ int HeatTransfer::setTemp()
 
         value = temp(iZ,iR);
         index = getIndex(iZ,iR);
-        ierr = VecSetValue(mpqd->xPast_p,index,value,ADD_VALUES);CHKERRQ(ierr); 
+        if (rows.contains(index))
+        {
+          ierr = VecSetValue(mpqd->xPast_p,index,value,ADD_VALUES);
+          CHKERRQ(ierr);
+        }
 
       }
     }
@@ -1016,6 +1124,7 @@ int HeatTransfer::buildSteadyStateLinearSystem_p()
   vector<double> gParams;
   PetscErrorCode ierr;
   PetscScalar value;
+  OwnedRows rows;
 
   updateBoundaryConditions();
   calcImplicitFluxes();
@@ -1028,6 +1137,8 @@ int HeatTransfer::buildSteadyStateLinearSystem_p()
   else
     volAvgGammaDep = calcExplicitFissionEnergy();
 
+  getOwnedRows(&(mpqd->A_p),&rows);
+
   //#pragma omp parallel for private(myIndex,sIndex,nIndex,wIndex,eIndex,\
   upwindIndex,gParams,cCoeff,coeff,keff,neutronFlux,harmonicAvg,iEq,iEqTemp)
     for (int iZ = 0; iZ < temp.rows(); iZ++)
@@ -1038,6 +1149,10 @@ int HeatTransfer::buildSteadyStateLinearSystem_p()
         iEq = getIndex(iZ,iR);
         iEqTemp = iEq - indexOffset;
 
+        // Rows owned by other ranks are assembled there
+        if (not rows.contains(iEq))
+          continue;
+
         // Reset center coefficient
         cCoeff = 0;
 
@@ -1215,10 +1330,10 @@ int HeatTransfer::buildLinearSystem_p()
   vector<double> gParams;
   PetscErrorCode ierr;
   PetscScalar value;
+  OwnedRows rows;
 
   updateBoundaryConditions();
-  calcDiracs();
-  calcFluxes();
+  calcAdvectionRate();
 
   // Calculate core-average gamma deposition term
   if (modIrradiation == axial)
@@ -1230,6 +1345,8 @@ int HeatTransfer::buildLinearSystem_p()
 
   Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> Atemp;
   
+  getOwnedRows(&(mpqd->A_p),&rows);
+
   //#pragma omp parallel for private(myIndex,sIndex,nIndex,wIndex,eIndex,\
     gParams,cCoeff,coeff,harmonicAvg,iEq,iEqTemp)
   for (int iZ = 0; iZ < temp.rows(); iZ++)
@@ -1241,6 +1358,10 @@ int HeatTransfer::buildLinearSystem_p()
       iEq = getIndex(iZ,iR);
       iEqTemp = iEq - indexOffset;
 
+      // Rows owned by other ranks are assembled there
+      if (not rows.contains(iEq))
+        continue;
+
       // Reset center coefficient
       cCoeff = 0;
 
@@ -1348,7 +1469,7 @@ int HeatTransfer::buildLinearSystem_p()
       //gammaSource(iZ,iR,iEqTemp,coeff);
 
       // Advection term
-      value = (mesh->dt/mesh->dzsCorner(iZ))*(flux(iZ,iR)-flux(iZ+1,iR));
+      value = mesh->dt*advRate(iZ,iR);
       ierr = VecSetValue(mpqd->b_p,iEq,value,ADD_VALUES);CHKERRQ(ierr); 
       //mpqd->b(iEq) += (mesh->dt/mesh->dzsCorner(iZ))*(flux(iZ,iR)-flux(iZ+1,iR));
 
@@ -1383,6 +1504,18 @@ void HeatTransfer::checkOptionalParams()
   {
     modIrradiation=(*input)["parameters"]["modIrradiation"].as<string>();
   }
+  if ((*input)["parameters"]["heatSubcycles"])
+  {
+    advSubcycles=(*input)["parameters"]["heatSubcycles"].as<int>();
+  }
+  if ((*input)["parameters"]["heatMacroSteps"])
+  {
+    advMacroSteps=(*input)["parameters"]["heatMacroSteps"].as<int>();
+  }
+  if ((*input)["parameters"]["advectionCourant"])
+  {
+    advCourant=(*input)["parameters"]["advectionCourant"].as<double>();
+  }
 
 }
 //==============================================================================
@@ -27,6 +27,13 @@ class HeatTransfer
   string modIrradiation = "volume", axial = "axial", volume = "volume",\
                            fuel = "fuel";
   string fluxLimiter = "superbee";
+
+  // Multirate advection parameters. Advection is subcycled advSubcycles
+  // times per step (or enough times to satisfy advCourant, if set) and
+  // re-evaluated only every advMacroSteps steps.
+  int advSubcycles = 1,advMacroSteps = 1,advUpdateState = -1;
+  double advCourant = 0.0;
+  Eigen::MatrixXd advRate;
   Eigen::SparseMatrix<double,Eigen::RowMajor> Atemp;
   Eigen::MatrixXd temp,flux,dirac,inletTemp;
   Eigen::VectorXd inletDensity,inletVelocity,inletcP,outletTemp;        
@@ -40,6 +47,9 @@ class HeatTransfer
   Eigen::MatrixXd calcExplicitAxialFuelFissionEnergy();
   void calcDiracs();
   void calcFluxes();
+  void calcFluxes(double advDt);
+  void calcAdvectionRate();
+  int calcNumSubcycles(double macroDt);
   void calcImplicitFluxes();
   void getTemp();
   int setTemp();
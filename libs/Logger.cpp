@@ -0,0 +1,377 @@
+// File: Logger.cpp
+// Purpose: Buffered, severity and module filtered logging for the solvers
+// Date: October 18, 2026
+
+#include "Logger.h"
+#include "WriteData.h"
+#include "Profiler.h"
+
+using namespace std;
+
+//==============================================================================
+/// Logger class object constructor
+///
+/// @param [in] myMesh mesh object
+Logger::Logger(Mesh * myMesh)
+{
+
+  int initialized = 0;
+
+  mesh = myMesh;
+
+  // Only rank 0 emits when running under MPI
+  MPI_Initialized(&initialized);
+  if (initialized)
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Logger class object destructor. Flushes anything still buffered.
+///
+Logger::~Logger()
+{
+
+  flush();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Determine whether a message would be emitted
+///
+/// @param [in] msgLevel severity of message
+/// @param [in] module name of module writing the message
+/// @return true if the message passes the rank, level, and module filters
+bool Logger::enabled(LogLevel msgLevel,const string & module)
+{
+
+  if (rank != 0 and msgLevel != logError)
+    return false;
+
+  if (moduleLevels.empty())
+    return msgLevel <= level;
+
+  auto moduleLevel = moduleLevels.find(module);
+  if (moduleLevel == moduleLevels.end())
+    return msgLevel <= level;
+
+  return msgLevel <= moduleLevel->second;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Start an error message
+///
+/// @param [in] module name of module writing the message
+/// @return stream collecting the message
+LogStream Logger::error(const char * module)
+{
+
+  return LogStream(this,logError,enabled(logError,module));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Start a warning message
+///
+/// @param [in] module name of module writing the message
+/// @return stream collecting the message
+LogStream Logger::warning(const char * module)
+{
+
+  return LogStream(this,logWarning,enabled(logWarning,module));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Start an informational message
+///
+/// @param [in] module name of module writing the message
+/// @return stream collecting the message
+LogStream Logger::info(const char * module)
+{
+
+  return LogStream(this,logInfo,enabled(logInfo,module));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Start a debugging message
+///
+/// @param [in] module name of module writing the message
+/// @return stream collecting the message
+LogStream Logger::debug(const char * module)
+{
+
+  return LogStream(this,logDebug,enabled(logDebug,module));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Start an informational message reporting iteration progress. Only every
+///   iterationEvery-th such message from a module is emitted.
+///
+/// @param [in] module name of module writing the message
+/// @return stream collecting the message
+LogStream Logger::iteration(const char * module)
+{
+
+  bool active = enabled(logInfo,module);
+
+  if (active and iterationEvery > 1)
+  {
+    lock_guard<mutex> lock(logMutex);
+    active = (iterationCounts[module]++ % iterationEvery == 0);
+  }
+
+  return LogStream(this,logInfo,active);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Append a message to the sink buffers
+///
+/// @param [in] msgLevel severity of message
+/// @param [in] text message text
+/// @param [in] format stream whose formatting state later messages inherit
+void Logger::write(LogLevel msgLevel,const string & text,const ostream & format)
+{
+
+  lock_guard<mutex> lock(logMutex);
+
+  streamFormat.copyfmt(format);
+
+  if (rank != 0)
+  {
+    consoleBuffer += "[rank " + to_string(rank) + "] " + text;
+    flushLocked();
+    return;
+  }
+
+  if (console)
+    consoleBuffer += text;
+  if (logFile.is_open())
+    fileBuffer += text;
+
+  // Errors and warnings are never held back
+  if (msgLevel <= logWarning or consoleBuffer.size() > bufferSize \
+    or fileBuffer.size() > bufferSize)
+    flushLocked();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Give a new message the formatting state left by the last one
+///
+/// @param [in] format stream to be formatted
+void Logger::loadFormat(ostream & format)
+{
+
+  lock_guard<mutex> lock(logMutex);
+
+  format.copyfmt(streamFormat);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Also write messages to a file in the output directory
+///
+/// @param [in] fileName name of log file
+void Logger::setFile(string fileName)
+{
+
+  string dir = mesh->output->getOutputPath("",true);
+
+  lock_guard<mutex> lock(logMutex);
+
+  if (rank != 0)
+    return;
+
+  mesh->output->makePath(dir);
+  logFile.open(dir + fileName);
+
+  if (not logFile.is_open())
+    cout << "Could not open log file " << dir + fileName << endl;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write out anything buffered
+///
+void Logger::flush()
+{
+
+  lock_guard<mutex> lock(logMutex);
+
+  flushLocked();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write out anything buffered. The caller must hold logMutex.
+///
+void Logger::flushLocked()
+{
+
+  if (not consoleBuffer.empty())
+  {
+    cout << consoleBuffer << std::flush;
+    consoleBuffer.clear();
+  }
+
+  if (not fileBuffer.empty())
+  {
+    logFile << fileBuffer << std::flush;
+    mesh->profiler->count("bytesWritten",fileBuffer.size());
+    fileBuffer.clear();
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Convert the name of a level to a LogLevel
+///
+/// @param [in] name one of error, warning, info, or debug
+/// @return corresponding level, or logInfo if not recognized
+LogLevel Logger::parseLevel(string name)
+{
+
+  if (name == "error")
+    return logError;
+  else if (name == "warning")
+    return logWarning;
+  else if (name == "debug")
+    return logDebug;
+  else if (name != "info")
+    cout << "Unrecognized log level " << name << ", using info." << endl;
+
+  return logInfo;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read logging parameters from the input file
+///
+/// @param [in] input YAML input object
+void Logger::checkOptionalParams(YAML::Node * input)
+{
+
+  YAML::Node params = (*input)["parameters"];
+
+  if (params["logLevel"])
+    level = parseLevel(params["logLevel"].as<string>());
+
+  // Per module levels, e.g. logModules: {MGHOT: warning, QDSolver: debug}
+  if (params["logModules"])
+  {
+    for (auto module : params["logModules"])
+      moduleLevels[module.first.as<string>()] = \
+        parseLevel(module.second.as<string>());
+  }
+
+  if (params["logIterationsEvery"])
+    iterationEvery = max(1,params["logIterationsEvery"].as<int>());
+
+  if (params["logBufferSize"])
+    bufferSize = params["logBufferSize"].as<size_t>();
+
+  if (params["logConsole"])
+    console = params["logConsole"].as<bool>();
+
+  if (params["logFile"])
+    setFile(params["logFile"].as<string>());
+
+};
+//==============================================================================
+
+//==============================================================================
+/// LogStream class object constructor
+///
+/// @param [in] myLogger logger the message is handed to
+/// @param [in] myLevel severity of message
+/// @param [in] myActive whether the message passed the logger's filters
+LogStream::LogStream(Logger * myLogger,LogLevel myLevel,bool myActive)
+{
+
+  logger = myLogger;
+  level = myLevel;
+  active = myActive;
+
+  if (active)
+    logger->loadFormat(text);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// LogStream move constructor. Only the new stream hands over the message.
+///
+/// @param [in] other stream being moved from
+LogStream::LogStream(LogStream && other) : text(move(other.text))
+{
+
+  logger = other.logger;
+  level = other.level;
+  active = other.active;
+  other.active = false;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// LogStream class object destructor. Hands the message to the logger.
+///
+LogStream::~LogStream()
+{
+
+  if (active)
+    logger->write(level,text.str(),text);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Apply a stream manipulator such as endl
+///
+/// @param [in] manipulator stream manipulator
+/// @return this stream
+LogStream & LogStream::operator<<(ostream & (*manipulator)(ostream &))
+{
+
+  if (active)
+    manipulator(text);
+
+  return *this;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Apply a formatting manipulator such as scientific
+///
+/// @param [in] manipulator formatting manipulator
+/// @return this stream
+LogStream & LogStream::operator<<(ios_base & (*manipulator)(ios_base &))
+{
+
+  if (active)
+    manipulator(text);
+
+  return *this;
+
+};
+//==============================================================================
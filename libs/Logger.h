@@ -0,0 +1,87 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <fstream>
+#include "Mesh.h"
+
+using namespace std;
+
+enum LogLevel {logError = 0, logWarning = 1, logInfo = 2, logDebug = 3};
+
+class LogStream;
+
+//==============================================================================
+//! Severity and module filtered logging with buffered console and file
+///   sinks. Only rank 0 emits under MPI, except for errors.
+
+class Logger
+{
+  public:
+    Logger(Mesh * myMesh);
+    ~Logger();
+    LogLevel level = logInfo;
+    map<string,LogLevel> moduleLevels;
+    int iterationEvery = 1;
+    size_t bufferSize = 65536;
+    bool console = true;
+    bool enabled(LogLevel msgLevel,const string & module);
+    LogStream error(const char * module);
+    LogStream warning(const char * module);
+    LogStream info(const char * module);
+    LogStream debug(const char * module);
+    LogStream iteration(const char * module);
+    void write(LogLevel msgLevel,const string & text,const ostream & format);
+    void loadFormat(ostream & format);
+    void setFile(string fileName);
+    void flush();
+    void checkOptionalParams(YAML::Node * input);
+    static LogLevel parseLevel(string name);
+
+  private:
+    void flushLocked();
+    string consoleBuffer,fileBuffer;
+    ofstream logFile;
+    ostringstream streamFormat;
+    map<string,long long> iterationCounts;
+    mutex logMutex;
+    int rank = 0;
+    Mesh * mesh;
+};
+
+//==============================================================================
+
+//==============================================================================
+//! Collects one message and hands it to the logger when it goes out of
+///   scope. Inactive streams discard everything written to them.
+
+class LogStream
+{
+  public:
+    LogStream(Logger * myLogger,LogLevel myLevel,bool myActive);
+    LogStream(LogStream && other);
+    ~LogStream();
+
+    template <typename T>
+    LogStream & operator<<(const T & value)
+    {
+      if (active)
+        text << value;
+      return *this;
+    };
+
+    LogStream & operator<<(ostream & (*manipulator)(ostream &));
+    LogStream & operator<<(ios_base & (*manipulator)(ios_base &));
+
+  private:
+    Logger * logger;
+    LogLevel level;
+    bool active;
+    ostringstream text;
+};
+
+//==============================================================================
+
+#endif
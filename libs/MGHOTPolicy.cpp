@@ -0,0 +1,210 @@
+// File: MGHOTPolicy.cpp     
+// Purpose: Decide when the MGHOT problem must be resolved and when lagged 
+//   Eddington factors can be reused 
+// Date: October 18, 2026
+
+#include "MGHOTPolicy.h"
+#include "Logger.h"
+
+using namespace std;
+
+//==============================================================================
+/// MGHOTPolicy class object constructor
+///
+/// @param [in] myMesh mesh object 
+/// @param [in] myInput input object 
+/// @param [in] myNGroups number of energy groups 
+MGHOTPolicy::MGHOTPolicy(Mesh * myMesh,\
+    YAML::Node * myInput,\
+    int myNGroups)
+{
+
+  mesh = myMesh;
+  input = myInput;
+  nGroups = myNGroups;
+
+  // Every group is solved until a drift rate has been measured
+  solveGroup.setConstant(nGroups,true);
+  passesSinceSolve.setZero(nGroups);
+  lastSolveStep.setConstant(nGroups,-1);
+  driftRate.setConstant(nGroups,-1.0);
+  lastDriftRate.setConstant(nGroups,-1.0);
+  passDriftRate.setConstant(nGroups,-1.0);
+
+  checkOptionalParams();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Decide which groups to solve on this MGHOT pass. 
+///
+/// A group is skipped if the Eddington factor drift predicted since its last
+/// solve is below driftTol. All groups are solved if the change in the LO 
+/// solution over a time step grows by more than residualGrowthTol relative to
+/// the previous step, and a group is always solved after refreshInterval 
+/// consecutive skips. Groups without a measured drift rate are solved.
+///
+/// @param [in] loResidual residual between the LO solution at the start of
+///   this MGHOT pass and the one before it 
+/// @param [in] firstPass whether this is the first MGHOT pass in a time step
+/// @return whether any group should be solved
+bool MGHOTPolicy::decide(double loResidual,bool firstPass)
+{
+
+  bool forceRefresh = false,anySolved = false;
+  double predictedDrift;
+
+  if (not adaptive)
+  {
+    solveGroup.fill(true);
+    return true;
+  }
+
+  // Check for growth in the LO residual between time steps
+  if (firstPass)
+  {
+    if (lastStepResidual > 0.0 and \
+        loResidual > residualGrowthTol*lastStepResidual)
+      forceRefresh = true;
+    lastStepResidual = loResidual;
+  }
+
+  LogStream decisions = mesh->logger->iteration("MGHOT");
+  decisions << "MGHOT policy:";
+  for (int iGroup = 0; iGroup < nGroups; iGroup++)
+  {
+    predictedDrift = predictDrift(iGroup);
+
+    solveGroup(iGroup) = forceRefresh or \
+      passesSinceSolve(iGroup) >= refreshInterval or predictedDrift >= driftTol;
+
+    if (solveGroup(iGroup))
+    {
+      anySolved = true;
+      decisions << " g" << iGroup << "=solve";
+    }
+    else 
+    {
+      passesSinceSolve(iGroup)++;
+      decisions << " g" << iGroup << "=reuse";
+    }
+  }
+  if (forceRefresh) decisions << " (LO residual growth)";
+  decisions << endl;
+
+  groupsSolved.push_back(solveGroup.count());
+
+  return anySolved;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Store the drift rate of the Eddington factors in the groups just solved.
+/// The residual of a group last solved in an earlier time step gives its
+/// drift per time step, and the residual of a group already solved in this
+/// step gives its drift per pass.
+///
+/// @param [in] residuals Eddington factor residual in each group since its
+///   last solve 
+void MGHOTPolicy::recordEddingtonDrift(Eigen::VectorXd residuals)
+{
+
+  int stepsSinceSolve;
+
+  for (int iGroup = 0; iGroup < nGroups; iGroup++)
+  {
+    if (not solveGroup(iGroup)) continue;
+
+    // The first solve has no earlier Eddington factors to drift from
+    if (lastSolveStep(iGroup) >= 0)
+    {
+      stepsSinceSolve = mesh->state - lastSolveStep(iGroup);
+      if (stepsSinceSolve > 0)
+      {
+        lastDriftRate(iGroup) = driftRate(iGroup);
+        driftRate(iGroup) = residuals(iGroup)/stepsSinceSolve;
+      }
+      else
+        passDriftRate(iGroup) = residuals(iGroup)\
+          /(passesSinceSolve(iGroup)+1);
+    }
+
+    lastSolveStep(iGroup) = mesh->state;
+    passesSinceSolve(iGroup) = 0;
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Predict the Eddington factor drift a group will have accumulated if it is
+/// solved on this pass. A group last solved in an earlier time step drifts 
+/// by its per step rate for each step since then. A group already solved in 
+/// this step drifts by its per pass rate for each pass since then.
+///
+/// @param [in] iGroup energy group 
+/// @return predicted drift, infinite if the rate has not been measured
+double MGHOTPolicy::predictDrift(int iGroup)
+{
+
+  int stepsSinceSolve = mesh->state - lastSolveStep(iGroup);
+  double predictedRate = driftRate(iGroup);
+
+  if (stepsSinceSolve == 0)
+  {
+    if (passDriftRate(iGroup) < 0.0)
+      return INFINITY;
+    return passDriftRate(iGroup)*(passesSinceSolve(iGroup)+1);
+  }
+
+  if (driftRate(iGroup) < 0.0)
+    return INFINITY;
+
+  // Extrapolate an increasing trend in the drift rate 
+  if (lastDriftRate(iGroup) > 0.0 and driftRate(iGroup) > lastDriftRate(iGroup))
+    predictedRate = predictedRate*driftRate(iGroup)/lastDriftRate(iGroup);
+
+  return predictedRate*stepsSinceSolve;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write the number of groups solved on each MGHOT pass of this step
+///
+/// @param [in] outputDir directory to write to
+void MGHOTPolicy::writeVars(string outputDir)
+{
+
+  if (adaptive)
+    mesh->output->write(outputDir,"MGHOT_groups_solved",groupsSolved);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read in optional parameters that might be specified in the input 
+///
+void MGHOTPolicy::checkOptionalParams()
+{
+
+  // Check if MGHOT solves should be skipped adaptively 
+  if ((*input)["parameters"]["adaptiveMGHOT"])
+    adaptive=(*input)["parameters"]["adaptiveMGHOT"].as<bool>();
+
+  // Check for Eddington factor drift tolerance 
+  if ((*input)["parameters"]["mghotDriftTol"])
+    driftTol=(*input)["parameters"]["mghotDriftTol"].as<double>();
+
+  // Check for LO residual growth that forces an MGHOT solve 
+  if ((*input)["parameters"]["mghotResidualGrowth"])
+    residualGrowthTol=(*input)["parameters"]["mghotResidualGrowth"].as<double>();
+
+  // Check for the maximum number of consecutive skips 
+  if ((*input)["parameters"]["mghotRefreshInterval"])
+    refreshInterval=(*input)["parameters"]["mghotRefreshInterval"].as<int>();
+
+};
+//==============================================================================
@@ -0,0 +1,43 @@
+#ifndef MGHOTPOLICY_H
+#define MGHOTPOLICY_H
+
+#include "Mesh.h"
+#include "WriteData.h"
+
+using namespace std;
+
+//==============================================================================
+//! Decides which groups need a new MGHOT solve and which can reuse lagged 
+///   Eddington factors and boundary conditions
+
+class MGHOTPolicy
+{
+  public:
+    MGHOTPolicy(Mesh * myMesh,\
+        YAML::Node * myInput,\
+        int myNGroups);
+    bool adaptive = false;
+    int nGroups,refreshInterval = 10;
+    double driftTol = 1E-6, residualGrowthTol = 10.0, lastStepResidual = -1.0;
+    VectorXb solveGroup;
+
+    // Eddington factors drift across time steps as the solution evolves, and
+    // within a step as the LO solution converges. driftRate is the drift per
+    // time step and passDriftRate the drift per MGHOT pass within a step.
+    Eigen::VectorXi passesSinceSolve,lastSolveStep;
+    Eigen::VectorXd driftRate,lastDriftRate,passDriftRate;
+    vector<int> groupsSolved;
+    bool decide(double loResidual,bool firstPass);
+    void recordEddingtonDrift(Eigen::VectorXd residuals);
+    double predictDrift(int iGroup);
+    void writeVars(string outputDir);
+    void checkOptionalParams();
+
+  private:
+    Mesh * mesh;
+    YAML::Node * input;
+};
+
+//==============================================================================
+
+#endif
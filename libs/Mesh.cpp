@@ -4,8 +4,13 @@
 // Author: Aaron James Reynolds
 // Date: October 9, 2019
 
+#include <algorithm>
+#include <stdexcept>
 #include "Mesh.h"
 #include "WriteData.h"
+#include "Profiler.h"
+#include "Logger.h"
+#include "Scheduler.h"
 
 using namespace std;
 
@@ -55,7 +60,9 @@ quadLevel::quadLevel(vector< vector<double> > myQuad,\
 /// Mesh Contructor for Mesh object.
 ///
 /// @param [in] myInput YAML input object for this simulation 
-Mesh::Mesh(YAML::Node * myInput){
+/// @param [in] runtimeMesh mesh whose output, profiler, logger, and 
+///   scheduler this mesh uses instead of creating and configuring its own
+Mesh::Mesh(YAML::Node * myInput,Mesh * runtimeMesh){
 
   // Variable for root output directory
   string myOutputDir;
@@ -85,14 +92,38 @@ Mesh::Mesh(YAML::Node * myInput){
   else
     myOutputDir = "output/";
 
+  // Share runtime objects with another mesh, e.g. a coarsened copy of it
+  if (runtimeMesh != NULL)
+  {
+    sharedRuntime = true;
+    output = runtimeMesh->output;
+    profiler = runtimeMesh->profiler;
+    logger = runtimeMesh->logger;
+    scheduler = runtimeMesh->scheduler;
+  }
+  else
+  {
+    // Initialize logger first, so the mesh set up can report problems
+    logger = new Logger(this);
+  }
+
   // Set up the mesh and quadrature set
   calcSpatialMesh();
   calcQuadSet();
   calcNumAnglesTotalWeight();
   calcTimeMesh();
 
-  // Initialize output object 
-  output = new WriteData(this,myOutputDir);
+  if (not sharedRuntime)
+  {
+    // Initialize output object 
+    output = new WriteData(this,myOutputDir);
+
+    // Initialize profiler 
+    profiler = new Profiler(this);
+
+    // Initialize thread scheduler 
+    scheduler = new Scheduler(this);
+  }
 
   // Check for optional parameters
   checkOptionalParams();
@@ -362,21 +393,28 @@ void Mesh::calcSpatialMesh(){
   dzCorner = dz/2;
   drCorner = dr/2;
 
+  // Calculate dimensions of each cell, which need not be uniform
+  dzs = calcCellWidths("z",Z,dz);
+  drs = calcCellWidths("r",R,dr);
+
   // Calculate number of cells
-  nCellsZ= Z/dz;
-  nCellsR = R/dr;
-  nCornersZ = Z/dzCorner;
-  nCornersR = R/drCorner;
+  nCellsZ = dzs.n_elem;
+  nCellsR = drs.n_elem;
+  nCornersZ = 2*nCellsZ;
+  nCornersR = 2*nCellsR;
 
-  // Resize vectors storing dimensions of each cell
-  dzs.zeros(nCellsZ);
-  dzs.fill(dz);
-  drs.zeros(nCellsR);
-  drs.fill(dr);
+  // Each cell is split into two corners of equal width 
   dzsCorner.zeros(nCornersZ);
-  dzsCorner.fill(dzCorner);
   drsCorner.zeros(nCornersR);
-  drsCorner.fill(drCorner);
+  for (int iCell = 0; iCell < nCellsZ; ++iCell){
+    dzsCorner(2*iCell) = dzs(iCell)/2;
+    dzsCorner(2*iCell+1) = dzs(iCell)/2;
+  }
+
+  for (int iCell = 0; iCell < nCellsR; ++iCell){
+    drsCorner(2*iCell) = drs(iCell)/2;
+    drsCorner(2*iCell+1) = drs(iCell)/2;
+  }
 
   // Resize vector holding boundaries in each dimension
   rEdge.zeros(nCellsR+1);
@@ -489,6 +527,118 @@ void Mesh::calcSpatialMesh(){
 }
 //==============================================================================
 
+//==============================================================================
+/// Calculate the widths of the cells along one axis. Cells are uniform 
+/// unless the mesh block lists the cell edges ("z edges"), divides the axis
+/// into geometrically graded zones ("z zones"), or asks for cell edges on the
+/// boundaries of the geometry regions ("align to geometry").
+///
+/// @param [in] axis axis to mesh, "z" or "r"
+/// @param [in] length extent of the domain along the axis
+/// @param [in] width uniform cell width, and the largest cell width when 
+///   aligning to the geometry
+/// @return width of each cell
+/// @throw invalid_argument if the cells do not tile [0, length]
+arma::rowvec Mesh::calcCellWidths(string axis,double length,double width)
+{
+
+  YAML::Node meshInput = (*input)["mesh"];
+  vector<double> edges = {0.0},bounds = {0.0,length};
+  arma::rowvec widths;
+  double lower,upper,ratio,cellWidth;
+  int nCells;
+
+  if (meshInput[axis + " edges"])
+  {
+    // Edges of every cell, starting at 0
+    edges = meshInput[axis + " edges"].as<vector<double>>();
+  }
+  else if (meshInput[axis + " zones"])
+  {
+    // Zones listed from the bottom (or center) out, e.g. 
+    // z zones: [{upper: 20.0, cells: 8, ratio: 0.8}, ...]
+    // Each cell in a zone is ratio times as wide as the one before it.
+    for (auto zone : meshInput[axis + " zones"])
+    {
+      lower = edges.back();
+      upper = zone["upper"].as<double>();
+      nCells = zone["cells"].as<int>();
+      ratio = zone["ratio"] ? zone["ratio"].as<double>() : 1.0;
+
+      if (abs(ratio - 1.0) < 1E-12)
+        cellWidth = (upper - lower)/nCells;
+      else
+        cellWidth = (upper - lower)*(ratio - 1.0)/(pow(ratio,nCells) - 1.0);
+
+      for (int iCell = 0; iCell < nCells - 1; ++iCell){
+        edges.push_back(edges.back() + cellWidth);
+        cellWidth = ratio*cellWidth;
+      }
+      edges.push_back(upper);
+    }
+  }
+  else if (meshInput["align to geometry"] \
+    and meshInput["align to geometry"].as<bool>())
+  {
+    // Collect the boundaries of every region along this axis
+    for (auto region : (*input)["geometry"])
+    {
+      if (region.first.as<string>() != "region")
+        continue;
+      if (axis == "z")
+      {
+        bounds.push_back(region.second["lower-z"].as<double>());
+        bounds.push_back(region.second["upper-z"].as<double>());
+      }
+      else
+      {
+        bounds.push_back(region.second["inner-r"].as<double>());
+        bounds.push_back(region.second["outer-r"].as<double>());
+      }
+    }
+    sort(bounds.begin(),bounds.end());
+
+    // Split the space between neighbouring boundaries into equal cells no
+    // wider than width
+    for (int iBound = 1; iBound < bounds.size(); ++iBound)
+    {
+      lower = edges.back();
+      upper = bounds[iBound];
+      if (upper > length or upper - lower < 1E-10*length)
+        continue;
+
+      nCells = ceil((upper - lower)/width - 1E-10);
+      for (int iCell = 1; iCell <= nCells; ++iCell)
+        edges.push_back(lower + iCell*(upper - lower)/nCells);
+    }
+  }
+  else
+  {
+    // Uniform cells
+    nCells = length/width;
+    widths.zeros(nCells);
+    widths.fill(width);
+    return widths;
+  }
+
+  widths.zeros(edges.size() - 1);
+  for (int iCell = 0; iCell < widths.n_elem; ++iCell)
+    widths(iCell) = edges[iCell + 1] - edges[iCell];
+
+  // A mesh that does not tile the domain cannot be solved on
+  if (widths.n_elem == 0 or widths.min() <= 0.0 or abs(edges[0]) > 0.0 \
+    or abs(edges.back() - length) > 1E-8*length)
+  {
+    logger->error("Mesh") << axis << " mesh edges must increase from 0 to " \
+      << length << "." << endl;
+    throw invalid_argument("invalid " + axis + " mesh");
+  }
+
+  return widths;
+
+};
+//==============================================================================
+
 //==============================================================================
 /// Build spatial mesh for recirculation mesh
 
@@ -753,6 +903,9 @@ void Mesh::calcTimeMesh(){
 
 void Mesh::advanceOneTimeStep()
 {
+  // Flush the output of the step that just finished
+  output->endStep();
+
   // Iterate on state and get new dt
   state += 1;        
   dt = dts[state-1];
@@ -1029,6 +1182,40 @@ void Mesh::checkOptionalParams()
     petsc=(*input)["parameters"]["petsc"].as<bool>();
   }
 
+  // Shared runtime objects were configured by the mesh that owns them
+  if (sharedRuntime)
+    return;
+
+  if ((*input)["parameters"]["outputFormat"])
+  {
+    output->setFormat((*input)["parameters"]["outputFormat"].as<string>());
+  }
+
+  // A run restarted from a checkpoint continues the existing binary output
+  if ((*input)["parameters"]["restartFile"])
+  {
+    output->restarting = true;
+  }
+
+  if ((*input)["parameters"]["profile"])
+  {
+    profiler->enabled=(*input)["parameters"]["profile"].as<bool>();
+  }
+
+  logger->checkOptionalParams(input);
+
+  scheduler->checkOptionalParams(input);
+  scheduler->configure();
+
+  if ((*input)["parameters"]["asyncOutput"])
+  {
+    int queueSize = 64;
+    if ((*input)["parameters"]["outputQueueSize"])
+      queueSize = (*input)["parameters"]["outputQueueSize"].as<int>();
+    output->setAsync((*input)["parameters"]["asyncOutput"].as<bool>(),\
+        queueSize);
+  }
+
 
 }
 //==============================================================================
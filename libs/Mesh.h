@@ -18,6 +18,9 @@
 using namespace std;
 
 class WriteData; // forward declaration
+class Profiler; // forward declaration
+class Logger; // forward declaration
+class Scheduler; // forward declaration
 
 class qdCell
 {
@@ -54,11 +57,11 @@ class quadLevel
 class Mesh
 {
 	public:
-	Mesh(YAML::Node * myInput);  	
+	Mesh(YAML::Node * myInput,Mesh * runtimeMesh = NULL);  	
   	int n,nAngles,nR,nZ;		
         int state = 1; 
         double dz,dr,drCorner,dzCorner,Z,R,dt,T,totalWeight; 
-        bool verbose = false,petsc = false;
+        bool verbose = false,petsc = false,sharedRuntime = false;
   	vector< vector<double> > quadSet;
   	vector< vector<double> > alpha;
         vector< vector<double> > tau;
@@ -83,6 +86,9 @@ class Mesh
         Eigen::MatrixXd volume;
         string outputDir = "mesh/";
         WriteData * output;
+        Profiler * profiler;
+        Logger * logger;
+        Scheduler * scheduler;
 
         // Recirculation loop parameters
         double dzCornerRecirc,recircZ;
@@ -107,6 +113,7 @@ class Mesh
 	void calcAlpha();
         void calcTau();
         void calcSpatialMesh();
+        arma::rowvec calcCellWidths(string axis,double length,double width);
         void calcQDCellIndices(int nCornersR,int nCornersZ);
         void addLevels();
  	void calcNumAnglesTotalWeight();
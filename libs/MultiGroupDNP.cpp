@@ -47,6 +47,27 @@ void MultiGroupDNP::readInput()
   Eigen::VectorXd lambdas;
   Eigen::MatrixXd betas;
 
+  // Check for multirate advection parameters
+  if ((*input)["parameters"]["dnpSubcycles"])
+  {
+    advSubcycles = (*input)["parameters"]["dnpSubcycles"].as<int>();
+  }
+  if ((*input)["parameters"]["dnpMacroSteps"])
+  {
+    advMacroSteps = (*input)["parameters"]["dnpMacroSteps"].as<int>();
+  }
+  if ((*input)["parameters"]["advectionCourant"])
+  {
+    advCourant = (*input)["parameters"]["advectionCourant"].as<double>();
+  }
+
+  // Check for recirculation loop model
+  if ((*input)["parameters"]["recircModel"])
+  {
+    delayLine = ((*input)["parameters"]["recircModel"].as<string>()\
+        == "delay line");
+  }
+
   // Set size of beta vector
   beta.setZero(mats->nGroups);
   
@@ -183,6 +204,14 @@ void MultiGroupDNP::readInput()
 ///
 void MultiGroupDNP::buildRecircLinearSystem()
 {
+  // Delay line model sets the recirculation solution directly
+  if (delayLine)
+  {
+    calcDelayLineRecircConc();
+    setRecircDNPConc();
+    return;
+  }
+
   recircA.setZero();
   recircb.setZero();
   for (int iGroup = 0; iGroup < DNPs.size(); ++iGroup)
@@ -197,6 +226,14 @@ void MultiGroupDNP::buildRecircLinearSystem()
 ///
 void MultiGroupDNP::buildSteadyStateRecircLinearSystem()
 {
+  // Delay line model sets the recirculation solution directly
+  if (delayLine)
+  {
+    calcDelayLineRecircConc(true);
+    setRecircDNPConc();
+    return;
+  }
+
   recircA.setZero();
   recircb.setZero();
   for (int iGroup = 0; iGroup < DNPs.size(); ++iGroup)
@@ -212,6 +249,10 @@ void MultiGroupDNP::buildSteadyStateRecircLinearSystem()
 ///
 void MultiGroupDNP::buildCoreLinearSystem()
 {
+  // Evaluate loop concentrations feeding the core inlet at this time
+  if (delayLine)
+    calcDelayLineRecircConc();
+
   for (int iGroup = 0; iGroup < DNPs.size(); ++iGroup)
   {
     DNPs[iGroup]->buildCoreLinearSystem();
@@ -225,6 +266,10 @@ void MultiGroupDNP::buildCoreLinearSystem()
 ///
 void MultiGroupDNP::buildSteadyStateCoreLinearSystem()
 {
+  // Evaluate loop concentrations feeding the core inlet
+  if (delayLine)
+    calcDelayLineRecircConc(true);
+
   for (int iGroup = 0; iGroup < DNPs.size(); ++iGroup)
   {
     DNPs[iGroup]->buildSteadyStateCoreLinearSystem();
@@ -372,6 +417,36 @@ void MultiGroupDNP::printRecircDNPConc()
 };
 //==============================================================================
 
+//==============================================================================
+/// Set recirculation loop DNP concentrations in each group with the delay 
+/// line model
+///
+/// @param [in] steadyState indicates whether to evaluate the steady state
+///   loop concentrations
+void MultiGroupDNP::calcDelayLineRecircConc(bool steadyState)
+{
+  for (int iGroup = 0; iGroup < DNPs.size(); ++iGroup)
+  {
+    DNPs[iGroup]->calcDelayLineRecircConc(steadyState);
+  }
+};
+//==============================================================================
+
+//==============================================================================
+/// Record converged core outlet DNP concentrations in each group's delay line
+///
+void MultiGroupDNP::updateDelayLines()
+{
+  if (not delayLine)
+    return;
+
+  for (int iGroup = 0; iGroup < DNPs.size(); ++iGroup)
+  {
+    DNPs[iGroup]->updateOutletHistory();
+  }
+};
+//==============================================================================
+
 //==============================================================================
 /// Solve linear system for multiphysics coupled quasidiffusion system
 ///
@@ -379,6 +454,11 @@ void MultiGroupDNP::solveRecircLinearSystem()
 {
   Eigen::SparseLU<Eigen::SparseMatrix<double>,\
     Eigen::COLAMDOrdering<int> > solverLU;
+
+  // Solution already set by delay line model
+  if (delayLine)
+    return;
+
   recircA.makeCompressed();
   solverLU.compute(recircA);
   recircx = solverLU.solve(recircb);
@@ -395,6 +475,10 @@ void MultiGroupDNP::solveRecircLinearSystem()
 ///
 void MultiGroupDNP::buildSteadyStateCoreLinearSystem_p()
 {
+  // Evaluate loop concentrations feeding the core inlet
+  if (delayLine)
+    calcDelayLineRecircConc(true);
+
   for (int iGroup = 0; iGroup < DNPs.size(); ++iGroup)
   {
     DNPs[iGroup]->buildSteadyStateCoreLinearSystem_p();
@@ -410,6 +494,15 @@ int MultiGroupDNP::buildSteadyStateRecircLinearSystem_p()
 {
   PetscErrorCode ierr;
 
+  // Delay line model sets the recirculation solution directly
+  if (delayLine)
+  {
+    calcDelayLineRecircConc(true);
+    ierr = VecZeroEntries(recircx_p);CHKERRQ(ierr);
+    setRecircDNPConc();
+    return ierr;
+  }
+
   // Reset linear system of recirculation loop
   MatZeroEntries(recircA_p);
   VecZeroEntries(recircb_p);
@@ -438,6 +531,10 @@ int MultiGroupDNP::buildSteadyStateRecircLinearSystem_p()
 ///
 void MultiGroupDNP::buildCoreLinearSystem_p()
 {
+  // Evaluate loop concentrations feeding the core inlet at this time
+  if (delayLine)
+    calcDelayLineRecircConc();
+
   for (int iGroup = 0; iGroup < DNPs.size(); ++iGroup)
   {
     DNPs[iGroup]->buildCoreLinearSystem_p();
@@ -453,6 +550,15 @@ int MultiGroupDNP::buildRecircLinearSystem_p()
 {
   PetscErrorCode ierr;
 
+  // Delay line model sets the recirculation solution directly
+  if (delayLine)
+  {
+    calcDelayLineRecircConc();
+    ierr = VecZeroEntries(recircx_p);CHKERRQ(ierr);
+    setRecircDNPConc();
+    return ierr;
+  }
+
   // Reset linear system of recirculation loop
   MatZeroEntries(recircA_p);
   VecZeroEntries(recircb_p);
@@ -487,6 +593,10 @@ int MultiGroupDNP::solveRecircLinearSystem_p()
   int its,m,n;
   double norm;
 
+  // Solution already set by delay line model
+  if (delayLine)
+    return 0;
+
   auto begin = chrono::high_resolution_clock::now();
   /* Get matrix dimensions */
   ierr = MatGetSize(recircA_p, &m, &n); CHKERRQ(ierr);
@@ -18,6 +18,9 @@ class MultiGroupDNP
   public:
     int indexOffset = 0;
     int nCoreUnknowns,nRecircUnknowns;
+    int advSubcycles = 1,advMacroSteps = 1;
+    double advCourant = 0.0;
+    bool delayLine = false;
     Eigen::VectorXd beta;
     vector< shared_ptr<SingleGroupDNP> > DNPs; 
     Eigen::VectorXd recircb,recircx;
@@ -41,6 +44,8 @@ class MultiGroupDNP
     void setRecircDNPConc();
     void printRecircDNPConc();
     void solveRecircLinearSystem();
+    void calcDelayLineRecircConc(bool steadyState = false);
+    void updateDelayLines();
     MultiPhysicsCoupledQD * mpqd;
     YAML::Node * input;
 
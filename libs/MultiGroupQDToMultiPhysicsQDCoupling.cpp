@@ -4,6 +4,8 @@
 // Date: April 9, 2020
 
 #include "MultiGroupQDToMultiPhysicsQDCoupling.h"
+#include "Profiler.h"
+#include "Logger.h"
 
 using namespace std;
 
@@ -67,8 +69,8 @@ bool MGQDToMPQDCoupling::solveOneStep()
     //cout << "xCurrentIter:" << endl;
     //cout << xCurrentIter << endl;
     residual = calcResidual(xPrevIter,xCurrentIter);
-    cout << "          "; 
-    cout << "MGQD->MPQD Residual: " << residual[0] <<", " << residual[1] <<endl; 
+    mesh->logger->iteration("ELOT") << "          MGQD->MPQD Residual: " \
+      << residual[0] << ", " << residual[1] << endl;
     if (residual[0] < mpqd->epsMPQD and residual[1] < mpqd->epsMPQD)
     {
       return true; 
@@ -96,18 +98,15 @@ void MGQDToMPQDCoupling::solveTransient()
     converged = solveOneStep();  
     if (not converged)
     {
-      cout << "Multigroup A: " << endl;
-      cout << mgqd->QDSolve->A << endl;
-      cout << endl;
-      cout << "Multigroup b: " << endl;
-      cout << mgqd->QDSolve->b << endl;
-      cout << endl;
-      cout << "Grey group A: " << endl;
-      cout << mpqd->A << endl;
-      cout << endl;
-      cout << "Grey group b: " << endl;
-      cout << mpqd->b << endl;
-      cout << endl;
+      mesh->logger->warning("ELOT") << "MGQD->MPQD solve not converged." \
+        << endl;
+
+      // Dumping the linear systems is only useful at small sizes
+      mesh->logger->debug("ELOT") << "Multigroup A: " << endl \
+        << mgqd->QDSolve->A << endl << endl \
+        << "Multigroup b: " << endl << mgqd->QDSolve->b << endl << endl \
+        << "Grey group A: " << endl << mpqd->A << endl << endl \
+        << "Grey group b: " << endl << mpqd->b << endl << endl;
       mgqd->updateVarsAfterConvergence(); 
       mpqd->updateVarsAfterConvergence();
       break;
@@ -142,6 +141,8 @@ void MGQDToMPQDCoupling::initCollapsedNuclearData()
 void MGQDToMPQDCoupling::collapseNuclearData()
 {
 
+  ScopedTimer timer(mesh->profiler,"ELOT/collapse");
+
   // Reset collapsed nuclear data
   mats->oneGroupXS->resetData();
 
@@ -6,6 +6,9 @@
 #include "SingleGroupTransport.h"
 #include "StartingAngle.h"
 #include "SimpleCornerBalance.h"
+#include "TransportDecomposition.h"
+#include "Profiler.h"
+#include "Logger.h"
 
 using namespace std; 
 
@@ -35,6 +38,12 @@ MultiGroupTransport::MultiGroupTransport(Materials * myMaterials,\
   startAngleSolve = std::make_shared<StartingAngle>(mesh,materials,input);
   SCBSolve = std::make_shared<SimpleCornerBalance>(mesh,materials,input);
 
+  // Split the sweeps over MPI ranks by group and quadrature level
+  decomposition = std::make_shared<TransportDecomposition>(mesh,input,\
+      materials->nGroups);
+  startAngleSolve->decomposition = decomposition.get();
+  SCBSolve->decomposition = decomposition.get();
+
   // Check to see if any convergence criteria are specified in input
   if ((*input)["parameters"]["epsAlpha"]){
     epsAlpha=(*input)["parameters"]["epsAlpha"].as<double>();
@@ -51,6 +60,14 @@ MultiGroupTransport::MultiGroupTransport(Materials * myMaterials,\
   if ((*input)["parameters"]["powerMaxIter"]){
     epsAlpha=(*input)["parameters"]["powerMaxIter"].as<double>();
   }
+  if ((*input)["parameters"]["freezeGroups"]){
+    freezeGroups=(*input)["parameters"]["freezeGroups"].as<bool>();
+  }
+
+  // All groups start out active
+  activeGroups.setConstant(materials->nGroups,true);
+  sweptGroups.setConstant(materials->nGroups,false);
+  if (freezeGroups) calcGroupCoupling();
 
 };
 
@@ -62,6 +79,7 @@ MultiGroupTransport::MultiGroupTransport(Materials * myMaterials,\
 void MultiGroupTransport::solveStartAngles()
 {
   for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
+    ScopedTimer timer(mesh->profiler,"group");
     SGTs[iGroup]->solveStartAngle();
   }
 };
@@ -74,7 +92,40 @@ void MultiGroupTransport::solveStartAngles()
 void MultiGroupTransport::solveSCBs()
 {
   for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
+    ScopedTimer timer(mesh->profiler,"group");
+    SGTs[iGroup]->solveSCB();
+    sweptGroups(iGroup) = true;
+  }
+};
+
+//==============================================================================
+
+//==============================================================================
+/// Wrapper over SGTs to call starting angle solver for a subset of groups
+///
+/// @param [in] solveGroup indicates which groups to solve
+void MultiGroupTransport::solveStartAngles(VectorXb solveGroup)
+{
+  for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
+    if (not solveGroup(iGroup)) continue;
+    ScopedTimer timer(mesh->profiler,"group");
+    SGTs[iGroup]->solveStartAngle();
+  }
+};
+
+//==============================================================================
+
+//==============================================================================
+/// Wrapper over SGTs to call SCB solver for a subset of groups
+///
+/// @param [in] solveGroup indicates which groups to solve
+void MultiGroupTransport::solveSCBs(VectorXb solveGroup)
+{
+  for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
+    if (not solveGroup(iGroup)) continue;
+    ScopedTimer timer(mesh->profiler,"group");
     SGTs[iGroup]->solveSCB();
+    sweptGroups(iGroup) = true;
   }
 };
 
@@ -105,16 +156,29 @@ bool MultiGroupTransport::calcFluxes(string printResidual)
   // Loop over SGTs, calculate fluxes, and determine whether the flux
   // in each SGT is converged
   for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
+    
+    // Groups that were not swept since their last flux calculation still 
+    // have up to date fluxes 
+    if (freezeGroups and not sweptGroups(iGroup)){
+      converged(iGroup) = true;
+      continue;
+    }
+
     residuals(iGroup)=SGTs[iGroup]->calcFlux();
     converged(iGroup) = residuals(iGroup) < epsFlux;
+    sweptGroups(iGroup) = false;
+
+    // Freeze groups that have converged
+    if (freezeGroups) activeGroups(iGroup) = not converged(iGroup);
   }
 
   // Print flux residuals
   if (printResidual == "print"){
+    LogStream residualLog = mesh->logger->iteration("MGHOT");
     for (int iResidual = 0; iResidual < residuals.size(); ++iResidual){
-      cout << setw(spacing) << residuals(iResidual);
+      residualLog << setw(spacing) << residuals(iResidual);
     }
-    cout << endl;
+    residualLog << endl;
   }
 
   // Perform an AND operation over all SGTs to determine whether
@@ -153,8 +217,20 @@ bool MultiGroupTransport::calcSources(string calcType)
   // Loop over SGTs, calculate sources, and determine whether the source
   // in each SGT is converged
   for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
+
+    // The source of a frozen group cannot change unless a group that 
+    // scatters or fissions into it is still active
+    if (freezeGroups and calcType != "fs" and calcType != "FS" \
+        and not activeGroups(iGroup) and not upstreamActive(iGroup)){
+      converged(iGroup) = true;
+      continue;
+    }
+
     residuals(iGroup)=SGTs[iGroup]->calcSource(calcType);
     converged(iGroup) = residuals(iGroup) < epsFissionSource;
+
+    // Re-activate frozen groups whose source changed significantly
+    if (freezeGroups and not converged(iGroup)) activeGroups(iGroup) = true;
   }
 
   // Perform an AND operation over all SGTs to determine whether
@@ -190,16 +266,19 @@ bool MultiGroupTransport::calcAlphas(string printResidual,string calcType)
   for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
     residuals(iGroup)=SGTs[iGroup]->calcAlpha(calcType);
     converged(iGroup) = residuals(iGroup) < epsAlpha;
+
+    // A new alpha changes the transport operator in this group 
+    if (not converged(iGroup)) activeGroups(iGroup) = true;
   }
 
   // Print alpha residuals
   if (printResidual == "print"){
-    cout << "Alpha residuals: " << endl;
+    LogStream residualLog = mesh->logger->info("MGHOT");
+    residualLog << "Alpha residuals: " << endl;
     for (int iResidual = 0; iResidual < residuals.size(); ++iResidual){
-      cout << setw(spacing) << residuals(iResidual);
+      residualLog << setw(spacing) << residuals(iResidual);
     }
-    cout << endl; 
-    cout << endl;
+    residualLog << endl << endl;
   } 
 
   // Perform an AND operation over all SGTs to determine whether
@@ -239,15 +318,18 @@ bool MultiGroupTransport::calcFissionSources(string printResidual)
   for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
     residuals(iGroup)=SGTs[iGroup]->calcFissionSource();
     converged(iGroup) = residuals(iGroup) < epsFissionSource;
+
+    // A new fission source requires this group to be re-swept
+    if (not converged(iGroup)) activeGroups(iGroup) = true;
   }
 
   if (printResidual == "print"){
-    cout << "Fission source residuals: " << endl;
+    LogStream residualLog = mesh->logger->info("MGHOT");
+    residualLog << "Fission source residuals: " << endl;
     for (int iResidual = 0; iResidual < residuals.size(); ++iResidual){
-      cout << setw(spacing) << residuals(iResidual);
+      residualLog << setw(spacing) << residuals(iResidual);
     }
-    cout << endl; 
-    cout << endl; 
+    residualLog << endl << endl;
   }
 
   // Perform an AND operation over all SGTs to determine whether
@@ -262,6 +344,62 @@ bool MultiGroupTransport::calcFissionSources(string printResidual)
 
 //==============================================================================
 
+//==============================================================================
+/// Calculate the largest scattering and fission transfer between each pair 
+/// of groups. Used to determine which frozen groups can be affected by 
+/// changes in the groups that are still active.
+void MultiGroupTransport::calcGroupCoupling()
+{
+
+  int rows = SGTs[0]->sFlux.rows();
+  int cols = SGTs[0]->sFlux.cols();
+  double transfer;
+
+  groupCoupling.setZero(materials->nGroups,materials->nGroups);
+
+  for (int iGroupPrime = 0; iGroupPrime < materials->nGroups; ++iGroupPrime){
+    for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
+      for (int iZ = 0; iZ < rows; ++iZ){
+        for (int iR = 0; iR < cols; ++iR){
+          transfer = materials->sigS(iZ,iR,iGroupPrime,iGroup)\
+            + materials->chiP(iZ,iR,iGroup)*materials->nu(iZ,iR,iGroup)\
+            *materials->sigF(iZ,iR,iGroupPrime);
+          groupCoupling(iGroupPrime,iGroup) = \
+            max(groupCoupling(iGroupPrime,iGroup),transfer);
+        } // iR
+      } // iZ
+    } // iGroup
+  } // iGroupPrime
+
+};
+
+//==============================================================================
+
+//==============================================================================
+/// Check whether any active group scatters or fissions into a group
+///
+/// @param [in] iGroup energy group receiving the source
+/// @param [out] active whether an upstream group is active
+bool MultiGroupTransport::upstreamActive(int iGroup)
+{
+  for (int iGroupPrime = 0; iGroupPrime < materials->nGroups; ++iGroupPrime){
+    if (activeGroups(iGroupPrime) and groupCoupling(iGroupPrime,iGroup) > 0)
+      return true;
+  }
+  return false;
+};
+
+//==============================================================================
+
+//==============================================================================
+/// Mark every group as needing a sweep
+void MultiGroupTransport::activateAllGroups()
+{
+  activeGroups.fill(true);
+};
+
+//==============================================================================
+
 //==============================================================================
 /// Iterate on a solution using a fixed source
 ///
@@ -280,13 +418,14 @@ bool MultiGroupTransport::sourceIteration()
     // fixed source. Then calculate the scalar flux with the newly calculated
     // angular flux
     calcSources("s"); 
-    solveStartAngles();
-    solveSCBs();
+    solveStartAngles(activeGroups);
+    solveSCBs(activeGroups);
     allConverged=calcFluxes("print");
 
     // If the fluxes are globally converged, break out of the for loop
     if (allConverged) {
-      cout << "Converged in " << iter+1 << " iteration(s)."<< endl;
+      mesh->logger->info("MGHOT") << "Converged in " << iter+1 \
+        << " iteration(s)." << endl;
       break;
     }
 
@@ -294,8 +433,9 @@ bool MultiGroupTransport::sourceIteration()
 
   // Print a statement indicating fixed source iteration was unsuccessful
   if(not(allConverged)){
-    cout << "Fixed source iteration did NOT converge within " << sourceMaxIter;
-    cout << " iterations." << endl;
+    mesh->logger->warning("MGHOT") \
+      << "Fixed source iteration did NOT converge within " << sourceMaxIter \
+      << " iterations." << endl;
   }
 
   return allConverged;
@@ -346,7 +486,10 @@ void MultiGroupTransport::solveTransportOnly()
 
   for (int iTime = 0; iTime < mesh->dts.size(); iTime++)
   {
-    cout << "Flux residuals: " << endl;
+    // Every group sees a new time step 
+    activateAllGroups();
+
+    mesh->logger->info("MGHOT") << "Flux residuals: " << endl;
     for (int iter = 0; iter < powerMaxIter; ++iter){
 
       // Perform source iteration
@@ -354,7 +497,7 @@ void MultiGroupTransport::solveTransportOnly()
 
       if (fluxConverged){
 
-        cout << endl; 
+        mesh->logger->info("MGHOT") << endl;
 
         // Perform power iteration
         printDividers();
@@ -364,16 +507,17 @@ void MultiGroupTransport::solveTransportOnly()
         // Problem is fully converged 
         if (fissionSourceConverged)
         {
-          cout << "Solution converged!" << endl;
+          mesh->logger->info("MGHOT") << "Solution converged!" << endl;
           break;
         } else
         {
-          cout << "Flux residuals: " << endl;
+          mesh->logger->info("MGHOT") << "Flux residuals: " << endl;
         }
 
       } else 
       {
-        cout << "Source iteration non-convergent." << endl;
+        mesh->logger->warning("MGHOT") << "Source iteration non-convergent." \
+          << endl;
         break;
       }
     }
@@ -394,13 +538,13 @@ void MultiGroupTransport::solveTransportOnly()
 
 void MultiGroupTransport::printDividers()
 {
+  LogStream dividerLog = mesh->logger->info("MGHOT");
   for (int iGroup = 0; iGroup < materials->nGroups; ++iGroup){
     for (int iSpace = 0; iSpace < spacing; ++iSpace ){
-      cout << "=";
+      dividerLog << "=";
     }
   }
-  cout << endl;
-  cout << endl;
+  dividerLog << endl << endl;
 };
 
 //==============================================================================
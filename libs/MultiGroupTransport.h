@@ -11,6 +11,7 @@ using namespace std;
 class SingleGroupTransport; // forward declaration
 class StartingAngle; // forward declaration
 class SimpleCornerBalance; // forward declaration
+class TransportDecomposition; // forward declaration
 
 //==============================================================================
 //! MultiGroupTransport class that holds multigroup transport information
@@ -21,6 +22,7 @@ class MultiGroupTransport
     vector< shared_ptr<SingleGroupTransport> > SGTs;
     shared_ptr<StartingAngle> startAngleSolve;
     shared_ptr<SimpleCornerBalance> SCBSolve;
+    shared_ptr<TransportDecomposition> decomposition;
     // public functions
     MultiGroupTransport(Materials * myMaterials,\
         Mesh * myMesh,\
@@ -37,6 +39,15 @@ class MultiGroupTransport
 
     // Boolean to determine use of grey group sources
     bool useMPQDSources = false;    
+
+    // Group-level convergence bookkeeping. When freezeGroups is set, groups
+    // whose fluxes have converged are not re-swept until a source they 
+    // depend on changes. groupCoupling(g',g) is the largest scattering plus
+    // fission transfer from g' into g. sweptGroups marks groups swept since
+    // their scalar flux was last calculated.
+    bool freezeGroups = false;
+    VectorXb activeGroups,sweptGroups;
+    Eigen::MatrixXd groupCoupling;
  
     // Pointers
     MultiPhysicsCoupledQD * mpqd;
@@ -44,12 +55,17 @@ class MultiGroupTransport
 
     // public functions
     void solveStartAngles();
+    void solveStartAngles(VectorXb solveGroup);
     void solveSCBs();
+    void solveSCBs(VectorXb solveGroup);
     bool calcSources(string calcType="FS");
     bool calcFluxes(string printResidual="noprint");
     bool calcAlphas(string printResidual="noprint", string calcType="");
     bool calcFissionSources(string printResidual="noprint");
     bool sourceIteration();
+    void calcGroupCoupling();
+    bool upstreamActive(int iGroup);
+    void activateAllGroups();
     bool powerIteration();
     void solveTransportOnly();
     void printDividers();
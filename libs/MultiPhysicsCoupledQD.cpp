@@ -8,6 +8,11 @@
 #include "HeatTransfer.h"
 #include "MultiGroupDNP.h"
 #include "GreyGroupQD.h"
+#include "GreyGroupCMFD.h"
+#include "StaticCondensation.h"
+#include "Profiler.h"
+#include "Scheduler.h"
+#include "Logger.h"
 
 using namespace std;
 
@@ -41,9 +46,11 @@ MultiPhysicsCoupledQD::MultiPhysicsCoupledQD(Materials * myMats,\
   // Set size of linear system
   nUnknowns = ggqd->nUnknowns + heat->nUnknowns + mgdnp->nCoreUnknowns;
   A.resize(nUnknowns,nUnknowns); 
-  x.setZero(nUnknowns); 
+  x.resize(nUnknowns); 
+  mesh->scheduler->firstTouch(x.data(),nUnknowns,Scheduler::assembly);
   xPast.setOnes(nUnknowns); 
-  b.setZero(nUnknowns);
+  b.resize(nUnknowns);
+  mesh->scheduler->firstTouch(b.data(),nUnknowns,Scheduler::assembly);
 
   /* Initialize PETSc variables */
   // Multiphysics system variables 
@@ -62,8 +69,28 @@ MultiPhysicsCoupledQD::MultiPhysicsCoupledQD(Materials * myMats,\
   // Initialize xPast 
   initializeXPast();
 
+  // Coarse mesh correction of guesses for iterative solves
+  cmfd = new GreyGroupCMFD(mesh,input,ggqd,nUnknowns);
+
   // Check optional parameters
   checkOptionalParams();
+
+  // The zeroth moment equation of a cell couples its grey group center flux
+  // to no other center flux, so each one can be eliminated on its own
+  if (condense)
+  {
+    vector< vector<int> > cellBlocks;
+    vector<int> indices;
+    for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
+    {
+      for (int iZ = 0; iZ < mesh->dzsCorner.size(); iZ++)
+      {
+        indices = ggqd->GGSolver->getIndices(iR,iZ);
+        cellBlocks.push_back(vector<int>(1,indices[0]));
+      }
+    }
+    condensation = new StaticCondensation(mesh,nUnknowns,cellBlocks);
+  }
 };
 //==============================================================================
 
@@ -274,12 +301,66 @@ void MultiPhysicsCoupledQD::initializeXPast()
 void MultiPhysicsCoupledQD::solveLinearSystem()
 {
 
+  condensed = condense and condensation->condense(A,b);
   solveSuperLU();
   mgdnp->solveRecircLinearSystem();
 
 };
 //==============================================================================
 
+//==============================================================================
+/// Run a factorized Krylov solver on the assembled system. With a coarse
+/// rebalance the solve is restarted every cmfd->cycleIterations iterations,
+/// and the rebalance is applied to the iterate before each cycle.
+///
+/// @param [in] solver Krylov solver factorized for the system being solved
+/// @param [in] xGuess initial guess over the full system
+/// @return outcome of the last cycle
+template <class KrylovSolver>
+int MultiPhysicsCoupledQD::solveKrylov(KrylovSolver & solver,\
+  Eigen::VectorXd xGuess)
+{
+
+  Eigen::VectorXd & systemB = condensed ? condensation->reducedB : b;
+  int nIterations = 0,maxIterations = solver.maxIterations();
+
+  if (cmfd->enabled)
+    solver.setMaxIterations(cmfd->cycleIterations);
+
+  do
+  {
+    if (cmfd->enabled)
+      cmfd->accelerate(A,b,xGuess);
+    if (condensed)
+      xGuess = condensation->restrictSolution(xGuess);
+    x = solver.solveWithGuess(systemB,xGuess);
+    if (condensed)
+      x = condensation->expandSolution(x);
+    nIterations += solver.iterations();
+    xGuess = x;
+  } while (cmfd->enabled and solver.info() == Eigen::NoConvergence \
+    and nIterations < maxIterations);
+
+  mesh->profiler->count("krylovIterations",nIterations);
+
+  if (mesh->verbose) 
+  {
+    LogStream solveLog = mesh->logger->iteration("ELOT");
+    solveLog << "            ";
+    solveLog << "info:     " << solver.info() << endl;
+    solveLog << "            ";
+    solveLog << "#iterations:     " << nIterations << endl;
+    solveLog << "            ";
+    solveLog << "estimated error: " << solver.error() << endl;
+    solveLog << "            ";
+    solveLog << "tolerance: " << solver.tolerance() << endl;
+  }
+
+  return solver.info();
+
+};
+//==============================================================================
+
 //==============================================================================
 /// Solve linear system for multiphysics coupled quasidiffusion system with an
 /// iterative solver
@@ -292,6 +373,8 @@ void MultiPhysicsCoupledQD::solveLinearSystemIterative(Eigen::VectorXd xGuess)
   int n = Eigen::nbThreads();
   int solveOutcome;
 
+  condensed = condense and condensation->condense(A,b);
+
   if (preconditioner == iluPreconditioner) 
     solveOutcome = solveIterativeILU(xGuess);
   else if (preconditioner == diagPreconditioner)
@@ -299,16 +382,16 @@ void MultiPhysicsCoupledQD::solveLinearSystemIterative(Eigen::VectorXd xGuess)
     solveOutcome = solveIterativeDiag(xGuess);
     if (solveOutcome != Eigen::Success)
     {
-      cout << "            " << "BiCGSTAB solve failed! Attempting iterative";
-      cout << " solve with ILU preconditioner." << endl;
+      mesh->logger->warning("ELOT") << "BiCGSTAB solve failed! Attempting "\
+        << "iterative solve with ILU preconditioner." << endl;
       solveOutcome = solveIterativeILU(xGuess);
     }
   }
 
   if (solveOutcome != Eigen::Success)
   {
-    cout << "            " << "Iterative solve failed! ";
-    cout << "Using SuperLU direct solve.";  
+    mesh->logger->warning("ELOT") << "Iterative solve failed! "\
+      << "Using SuperLU direct solve." << endl;
     solveSuperLU();
   }
 
@@ -330,8 +413,17 @@ int MultiPhysicsCoupledQD::solveSuperLU()
   // Declare SuperLU solver
   Eigen::SuperLU<Eigen::SparseMatrix<double>> solverLU;
   A.makeCompressed();
-  solverLU.compute(A);
-  x = solverLU.solve(b);
+
+  // Solve the condensed system instead if one was formed
+  Eigen::SparseMatrix<double,Eigen::RowMajor> & systemA = \
+    condensed ? condensation->reducedA : A;
+  Eigen::VectorXd & systemB = condensed ? condensation->reducedB : b;
+
+  solverLU.compute(systemA);
+  mesh->profiler->count("factorizations");
+  x = solverLU.solve(systemB);
+  if (condensed)
+    x = condensation->expandSolution(x);
 
   // Return outcome of solve
   return success = solverLU.info();
@@ -361,26 +453,17 @@ int MultiPhysicsCoupledQD::solveIterativeILU(Eigen::VectorXd xGuess)
   //solver.setTolerance(1E-14);
   //solver.setMaxIterations(20);
 
+  // Solve the condensed system instead if one was formed
+  Eigen::SparseMatrix<double,Eigen::RowMajor> & systemA = \
+    condensed ? condensation->reducedA : A;
+
   // Solve system
   A.makeCompressed();
-  solver.analyzePattern(A);
-  solver.factorize(A);
-  x = solver.solveWithGuess(b,xGuess);
-
-  if (mesh->verbose) 
-  {
-    cout << "            ";
-    cout << "info:     " << solver.info() << endl;
-    cout << "            ";
-    cout << "#iterations:     " << solver.iterations() << endl;
-    cout << "            ";
-    cout << "estimated error: " << solver.error() << endl;
-    cout << "            ";
-    cout << "tolerance: " << solver.tolerance() << endl;
-  }
+  solver.analyzePattern(systemA);
+  solver.factorize(systemA);
 
   // Return outcome of solve
-  return success = solver.info();
+  return success = solveKrylov(solver,xGuess);
 
 };
 //==============================================================================
@@ -402,26 +485,17 @@ int MultiPhysicsCoupledQD::solveIterativeDiag(Eigen::VectorXd xGuess)
   //solver.setTolerance(1E-14);
   //solver.setMaxIterations(20);
 
+  // Solve the condensed system instead if one was formed
+  Eigen::SparseMatrix<double,Eigen::RowMajor> & systemA = \
+    condensed ? condensation->reducedA : A;
+
   // Solve system
   A.makeCompressed();
-  solver.analyzePattern(A);
-  solver.factorize(A);
-  x = solver.solveWithGuess(b,xGuess);
-
-  if (mesh->verbose) 
-  {
-    cout << "            ";
-    cout << "info:     " << solver.info() << endl;
-    cout << "            ";
-    cout << "#iterations:     " << solver.iterations() << endl;
-    cout << "            ";
-    cout << "estimated error: " << solver.error() << endl;
-    cout << "            ";
-    cout << "tolerance: " << solver.tolerance() << endl;
-  }
+  solver.analyzePattern(systemA);
+  solver.factorize(systemA);
 
   // Return outcome of solve
-  return success = solver.info();
+  return success = solveKrylov(solver,xGuess);
 
 };
 //==============================================================================
@@ -441,6 +515,8 @@ void MultiPhysicsCoupledQD::updateVarsAfterConvergence()
 
   mgdnp->getRecircDNPConc();
 
+  mgdnp->updateDelayLines();
+
   // Back calculate currents
   ggqd->GGSolver->formBackCalcSystem();
   ggqd->GGSolver->backCalculateCurrent();
@@ -470,6 +546,8 @@ void MultiPhysicsCoupledQD::updateSteadyStateVarsAfterConvergence()
 
   mgdnp->getRecircDNPConc();
 
+  mgdnp->updateDelayLines();
+
   // Back calculate currents
   ggqd->GGSolver->formSteadyStateBackCalcSystem();
   ggqd->GGSolver->backCalculateCurrent();
@@ -631,15 +709,20 @@ int MultiPhysicsCoupledQD::solve_p()
   ierr = KSPGetPC(ksp,&pc);CHKERRQ(ierr);
   ierr = PCSetType(pc,PetscPreconditioner.c_str());CHKERRQ(ierr);
 
+  /* Start from the current contents of x_p */
+  ierr = KSPSetInitialGuessNonzero(ksp,PETSC_TRUE);CHKERRQ(ierr);
+
   /* Solve the system */
   ierr = KSPSolve(ksp,b_p,x_p);CHKERRQ(ierr);
   auto end = chrono::high_resolution_clock::now();
   auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
   //ierr = VecView(x_p,PETSC_VIEWER_STDOUT_WORLD);CHKERRQ(ierr);
-  cout << "solve time: " << elapsed.count()*1e-9 << endl;
+  mesh->logger->iteration("ELOT") << "solve time: " \
+    << elapsed.count()*1e-9 << endl;
 
   /* Print solve information */
   ierr = KSPGetIterationNumber(ksp,&its);CHKERRQ(ierr);
+  mesh->profiler->count("krylovIterations",its);
   ierr = PetscPrintf(PETSC_COMM_WORLD,"Norm of error %g iterations %D\n",(double)norm,its);CHKERRQ(ierr);
   
   /* Destroy solver */
@@ -708,6 +791,8 @@ void MultiPhysicsCoupledQD::updateSteadyStateVarsAfterConvergence_p()
 
   mgdnp->getRecircDNPConc();
 
+  mgdnp->updateDelayLines();
+
   // Back calculate currents
   // ToDo Add PETSc support for back calc system
   ggqd->GGSolver->formSteadyStateBackCalcSystem_p();
@@ -821,6 +906,8 @@ void MultiPhysicsCoupledQD::updateVarsAfterConvergence_p()
 
   mgdnp->getRecircDNPConc();
 
+  mgdnp->updateDelayLines();
+
   // Back calculate currents
   // ToDo Add PETSc support for back calc system
   ggqd->GGSolver->formBackCalcSystem_p();
@@ -856,6 +943,9 @@ void MultiPhysicsCoupledQD::checkOptionalParams()
     epsMPQD=(*input)["parameters"]["epsMPQD"].as<double>();
   }
 
+  if ((*input)["parameters"]["condenseELOT"])
+    condense = (*input)["parameters"]["condenseELOT"].as<bool>();
+
   if ((*input)["parameters"]["preconditionerELOT"])
   {
     precondInput=(*input)["parameters"]["preconditionerELOT"].as<string>();
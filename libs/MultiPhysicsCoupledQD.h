@@ -12,6 +12,8 @@ using namespace std;
 class HeatTransfer;
 class MultiGroupDNP;
 class GreyGroupQD;
+class GreyGroupCMFD;
+class StaticCondensation;
 
 //==============================================================================
 //! Contains precursor, heat, and grey group quasidiffusion objects.
@@ -56,6 +58,8 @@ class MultiPhysicsCoupledQD
     void printVars();
     void checkOptionalParams();
     int preconditioner = 1;
+    bool condense = false,condensed = false;
+    StaticCondensation * condensation = NULL;
 
     // PETSc variables
     Vec x_p,xPast_p,b_p;
@@ -81,12 +85,15 @@ class MultiPhysicsCoupledQD
     HeatTransfer * heat;
     MultiGroupDNP * mgdnp;
     GreyGroupQD * ggqd;
+    GreyGroupCMFD * cmfd;
 
   private:
     Materials * mats;
     Mesh * mesh;
     YAML::Node * input;
     const int iluPreconditioner = 0, diagPreconditioner = 1;
+    template <class KrylovSolver>
+    int solveKrylov(KrylovSolver & solver,Eigen::VectorXd xGuess);
 
 };
 
@@ -3,6 +3,8 @@
 // Date: May 27, 2020
 
 #include "MultilevelCoupling.h"
+#include "TransportDecomposition.h"
+#include "Scheduler.h"
 
 using namespace std;
 
@@ -42,6 +44,9 @@ MultilevelCoupling::MultilevelCoupling(Mesh * myMesh,\
 
   // Create MGT to MGQD coupling object
   MGTToMGQD = new TransportToQDCoupling(mats,mesh,input,mgt,mgqd);
+
+  // Create coarse mesh MGHOT solver, if the input asks for one
+  coarseMGHOT = new CoarseMeshTransport(mesh,mats,input,mgt);
  
   // Create MGQD to MPQD coupling object
   MGQDToMPQD = new MGQDToMPQDCoupling(mesh,mats,input,mpqd,mgqd);
@@ -49,6 +54,19 @@ MultilevelCoupling::MultilevelCoupling(Mesh * myMesh,\
   // Check for optional input parameters 
   checkOptionalParameters();
 
+  // Create solution histories used to predict initial guesses
+  elotHistory = new SolutionHistory(extrapolationOrder,historyLength);
+  mgloqdHistory = new SolutionHistory(extrapolationOrder,historyLength);
+
+  // Create policy deciding when MGHOT solves can be skipped
+  mghotPolicy = new MGHOTPolicy(mesh,input,mats->nGroups);
+
+  // Create in-situ diagnostics
+  diagnostics = new Diagnostics(mesh,mats,input,mpqd);
+
+  // Create per-iteration convergence trace
+  trace = new ConvergenceTrace(mesh,input);
+
 };
 //==============================================================================
 
@@ -93,14 +111,13 @@ bool MultilevelCoupling::solveOneStep()
 
     // Repeat until ||xCurrentIter - xLastIter|| < eps 
     residual = MGQDToMPQD->calcResidual(xLastIter,xCurrentIter);
-    cout << endl; 
-    cout << "MGT->MGQD->MPQD Residual: " << residual[0] << endl;
-    cout << endl;
+    mesh->logger->iteration("Multilevel") << endl \
+      << "MGT->MGQD->MPQD Residual: " << residual[0] << endl << endl;
     if (residual[0] < mpqd->epsMPQD\
         and residual[1] < mpqd->epsMPQD\
         and eddingtonConverged) 
     {
-      cout << "Solve converged." << endl;
+      mesh->logger->info("Multilevel") << "Solve converged." << endl;
       mgt->writeFluxes();
       return true;
     }
@@ -139,7 +156,7 @@ bool MultilevelCoupling::initialSolve()
     // Store last iterate of ELOT solution used in MGLOQD level
     xLastMGLOQDIter = mpqd->x;
   
-    cout << endl;
+    mesh->logger->info("Multilevel") << endl;
     
     while (not convergedELOT) {
 
@@ -164,9 +181,8 @@ bool MultilevelCoupling::initialSolve()
 
       // Repeat until ||xCurrentIter - xLastIter|| < eps 
       residualELOT = MGQDToMPQD->calcResidual(xLastELOTIter,xCurrentIter);
-      cout << "        ";
-      cout << "ELOT Residual: " << residualELOT[0]; 
-      cout << ", " << residualELOT[1] << endl;
+      mesh->logger->iteration("ELOT") << "        ELOT Residual: " \
+        << residualELOT[0] << ", " << residualELOT[1] << endl;
       itersELOT++;
       
       // Calculate collapnuclear data at new temperature
@@ -190,7 +206,7 @@ bool MultilevelCoupling::initialSolve()
 
     } // ELOT
       
-    cout << endl;
+    mesh->logger->info("Multilevel") << endl;
 
     // Reset ELOT residual
     convergedELOT = false; 
@@ -201,9 +217,8 @@ bool MultilevelCoupling::initialSolve()
 
     // Calculate MGLOQD residual 
     residualMGLOQD = MGQDToMPQD->calcResidual(xLastMGLOQDIter,xCurrentIter);
-    cout << "    ";
-    cout << "MGLOQD Residual: " << residualMGLOQD[0];
-    cout << ", " << residualMGLOQD[1] << endl;
+    mesh->logger->iteration("MGLOQD") << "    MGLOQD Residual: " \
+      << residualMGLOQD[0] << ", " << residualMGLOQD[1] << endl;
     itersMGLOQD++;
 
     // Check converge criteria 
@@ -215,9 +230,8 @@ bool MultilevelCoupling::initialSolve()
 
   } // MGLOQD
     
-  cout << endl;
-  cout << "MGLOQD iterations: " << itersMGLOQD << endl;
-  cout << "ELOT iterations: " << itersELOT << endl;
+  mesh->logger->info("Multilevel") << endl << "MGLOQD iterations: " \
+    << itersMGLOQD << endl << "ELOT iterations: " << itersELOT << endl;
 
   return true;
 
@@ -231,15 +245,17 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
 {
 
   Eigen::VectorXd xCurrentIter, xLastMGHOTIter, xLastMGLOQDIter,xLastELOTIter,\
-    residualVector;
+    residualVector, xStepStart;
   vector<double> lastResidualELOT, lastResidualMGLOQD, residualMGHOT = {1,1,1},\
     residualMGLOQD = {1,1,1}, residualELOT = {1,1,1};
-  bool eddingtonConverged;
+  bool eddingtonConverged, predicted;
   bool convergedMGHOT=false, convergedMGLOQD=false, convergedELOT=false;
   int itersMGHOT = 0, itersMGLOQD = 0, itersELOT = 0;
   vector<int> iters;
   vector<double> tempResMGHOT,tempResMGLOQD,tempResELOT,tempResiduals;
   vector<double> fluxResMGHOT,fluxResMGLOQD,fluxResELOT,fluxResiduals;
+  vector<double> targets;
+  double mghotSeconds = 0.0,mgloqdSeconds = 0.0,eddingtonResidual = NAN;
  
   // Timing variables 
   double duration,totalDuration = 0.0,elotDuration = 0,\
@@ -247,6 +263,12 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
   clock_t startTime;
   auto begin = chrono::high_resolution_clock::now();
 
+  // Start from solutions extrapolated from previous time steps. The first
+  // MGHOT residual is still measured from the last converged state.
+  xStepStart = mpqd->x;
+  predicted = predictInitialGuess();
+  mghotPolicy->groupsSolved.clear();
+
   while (not convergedMGHOT){ 
 
     ////////////////////
@@ -256,32 +278,58 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
     // Only solve the MGHOT after we've got an estimate for the ELOT solution
     if (itersMGHOT != 0 and not p1Approx)
     {
+      // Decide which groups need a new transport solution. If none do,
+      // the lagged Eddington factors and BCs would reproduce the current 
+      // LO solution, so the step is done.
+      if (not mghotPolicy->decide(residualMGHOT[0],itersMGHOT == 1))
+      {
+        mesh->logger->info("MGHOT") \
+          << "MGHOT solve skipped, reusing lagged Eddington factors." << endl;
+        trace->record(ConvergenceTrace::levelMGHOT,itersMGHOT,residualMGHOT,\
+          {eps(mpqd->epsMPQD),eps(mpqd->epsMPQD)},NAN,0.0,\
+          ConvergenceTrace::skipped);
+        break;
+      }
+
       // Solve MGHOT problem
-      cout << "MGHOT solve...";
+      mesh->logger->info("MGHOT") << "MGHOT solve...";
       //startTime = clock(); 
       auto begin = chrono::high_resolution_clock::now();
-      solveMGHOT();
+      if (pipelineMGHOT)
+        eddingtonConverged = solveMGHOTPipelined();
+      else
+        solveMGHOT();
       auto end = chrono::high_resolution_clock::now();
       auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
       duration = elapsed.count()*1e-9;
       //duration = (clock() - startTime)/(double)CLOCKS_PER_SEC;
       mghotDuration = mghotDuration + duration;
-      cout << " done. ("<< duration << " seconds)" << endl;
+      mghotSeconds = duration;
+      mesh->logger->info("MGHOT") << " done. (" << duration << " seconds)" \
+        << endl;
       iters.push_back(3);
 
-      // Calculate Eddington factors for MGQD problem
-      cout << "Calculating MGLOQD Eddington factors...";
-      eddingtonConverged = MGTToMGQD->calcEddingtonFactors();
-      cout << " done."<< endl;
-
-      // Calculate BCs for MGQD problem 
-      cout << "Calculating MGLOQD boundary conditions...";
-      MGTToMGQD->calcBCs();
-      cout << " done."<< endl;
+      // The pipelined solve has already coupled each group to the MGLOQD
+      if (not pipelineMGHOT)
+      {
+        // Calculate Eddington factors for MGQD problem
+        mesh->logger->info("MGLOQD") \
+          << "Calculating MGLOQD Eddington factors...";
+        eddingtonConverged = MGTToMGQD->calcEddingtonFactors();
+        mesh->logger->info("MGLOQD") << " done." << endl;
+
+        // Calculate BCs for MGQD problem 
+        mesh->logger->info("MGLOQD") \
+          << "Calculating MGLOQD boundary conditions...";
+        MGTToMGQD->calcBCs();
+        mesh->logger->info("MGLOQD") << " done." << endl;
+      }
+      eddingtonResidual = MGTToMGQD->eddingtonResiduals.maxCoeff();
+      mghotPolicy->recordEddingtonDrift(MGTToMGQD->eddingtonResiduals);
     }
 
     // Store last iterate of ELOT solution used in MGHOT level
-    xLastMGHOTIter = mpqd->x;
+    xLastMGHOTIter = (itersMGHOT == 0) ? xStepStart : mpqd->x;
     
     while (not convergedMGLOQD){
 
@@ -290,8 +338,7 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
       /////////////////////
 
       // Solve MGLOQD problem
-      cout << "    ";
-      cout << "MGLOQD solve..." << endl;
+      mesh->logger->info("MGLOQD") << "    MGLOQD solve..." << endl;
       //startTime = clock(); 
       auto begin = chrono::high_resolution_clock::now();
       solveMGLOQD();
@@ -300,8 +347,9 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
       duration = elapsed.count()*1e-9;
       //duration = (clock() - startTime)/(double)CLOCKS_PER_SEC;
       mgloqdDuration = mgloqdDuration + duration;
-      cout << "    ";
-      cout << "MGLOQD solve done. ("<< duration << " seconds)" << endl;
+      mgloqdSeconds = duration;
+      mesh->logger->info("MGLOQD") << "    MGLOQD solve done. (" << duration \
+        << " seconds)" << endl;
       iters.push_back(2);
 
       // Get group fluxes to use in group collapse
@@ -317,20 +365,18 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
         ///////////////////
 
         // Calculate collapsed nuclear data
-        cout << "        ";
-        cout << "Collapsing MGLOQD data for ELOT solve...";
+        mesh->logger->info("ELOT") \
+          << "        Collapsing MGLOQD data for ELOT solve...";
         MGQDToMPQD->collapseNuclearData();
-        cout << " done."<< endl;
+        mesh->logger->info("ELOT") << " done." << endl;
         
         // Store last iterate of ELOT solution used in ELOT level
-        cout << "        ";
-        cout << "Storing last solution...";
+        mesh->logger->info("ELOT") << "        Storing last solution...";
         xLastELOTIter = mpqd->x;
-        cout << " done."<< endl;
+        mesh->logger->info("ELOT") << " done." << endl;
       
         // Solve ELOT problem
-        cout << "        ";
-        cout << "ELOT solve..." << endl;
+        mesh->logger->info("ELOT") << "        ELOT solve..." << endl;
         //startTime = clock(); 
         auto begin = chrono::high_resolution_clock::now();
         solveELOT(mpqd->x);
@@ -339,8 +385,8 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
         duration = elapsed.count()*1e-9;
         //duration = (clock() - startTime)/(double)CLOCKS_PER_SEC;
         elotDuration = elotDuration + duration;
-        cout << "        ";
-        cout << "ELOT solve done. ("<< duration << " seconds)" << endl;
+        mesh->logger->info("ELOT") << "        ELOT solve done. (" << duration \
+          << " seconds)" << endl;
         iters.push_back(1);
 
         // Store newest iterate 
@@ -351,9 +397,8 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
         // Calculate and print ELOT residual  
         residualELOT = MGQDToMPQD->calcResidual(xLastELOTIter,xCurrentIter);
         residualELOT = MGQDToMPQD->calcResidual(xCurrentIter,xLastELOTIter);
-        cout << "        ";
-        cout << "ELOT Residual: " << residualELOT[0]; 
-        cout << ", " << residualELOT[1] << endl;
+        mesh->logger->iteration("ELOT") << "        ELOT Residual: " \
+          << residualELOT[0] << ", " << residualELOT[1] << endl;
 
         // Update iterate counters, store residuals
         itersELOT++;
@@ -363,11 +408,18 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
         // Calculate collapsed nuclear data at new temperature
         mats->updateTemperature(mpqd->heat->returnCurrentTemp());
 
+        // Thresholds this iterate is checked against
+        targets = {eps(residualMGLOQD[0],relaxTolELOT),\
+          eps(residualMGLOQD[1],relaxTolELOT)};
+
         // Check if residuals are too big or if the residuals have increased
         // from the last MGLOQD residual 
         if (residualELOT[0]/lastResidualELOT[0] > resetThreshold and\
             residualELOT[1]/lastResidualELOT[1] > resetThreshold) 
         {
+          trace->record(ConvergenceTrace::levelELOT,itersELOT,residualELOT,\
+            targets,NAN,duration,ConvergenceTrace::reset);
+
           // Jump back to MGLOQD level
           break;
         }
@@ -379,6 +431,10 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
           convergedELOT = true;
         }
 
+        trace->record(ConvergenceTrace::levelELOT,itersELOT,residualELOT,\
+          targets,NAN,duration,convergedELOT ? ConvergenceTrace::converged \
+          : ConvergenceTrace::iterate);
+
       } // ELOT
     
       // Reset convergence indicator
@@ -393,11 +449,8 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
       // Calculate and print MGLOQD residual 
       residualMGLOQD = MGQDToMPQD->calcResidual(xLastMGLOQDIter,xCurrentIter);
       residualMGLOQD = MGQDToMPQD->calcResidual(xCurrentIter,xLastMGLOQDIter);
-      cout << endl;
-      cout << "    ";
-      cout << "MGLOQD Residual: " << residualMGLOQD[0];
-      cout << ", " << residualMGLOQD[1] << endl;
-      cout << endl;
+      mesh->logger->iteration("MGLOQD") << endl << "    MGLOQD Residual: " \
+        << residualMGLOQD[0] << ", " << residualMGLOQD[1] << endl << endl;
         
       // Update iterate counters, store residuals
       itersMGLOQD++;
@@ -412,11 +465,18 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
           tempResELOT.begin(),tempResELOT.end());
       tempResELOT.clear();
 
+      // Thresholds this iterate is checked against
+      targets = {eps(residualMGHOT[0],relaxTolMGLOQD),\
+        eps(residualMGHOT[1],relaxTolMGLOQD)};
+
       // Check if residuals are too big or if the residuals have increased
       // from the last MGLOQD residual 
       if (residualMGLOQD[0]/lastResidualMGLOQD[0] > resetThreshold or\
           residualMGLOQD[1]/lastResidualMGLOQD[1] > resetThreshold) 
       {
+        trace->record(ConvergenceTrace::levelMGLOQD,itersMGLOQD,residualMGLOQD,\
+          targets,NAN,mgloqdSeconds,ConvergenceTrace::reset);
+
         // Jump back to MGHOT level
         break;
       }
@@ -428,6 +488,10 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
         convergedMGLOQD = true;
       }
 
+      trace->record(ConvergenceTrace::levelMGLOQD,itersMGLOQD,residualMGLOQD,\
+        targets,NAN,mgloqdSeconds,convergedMGLOQD ? \
+        ConvergenceTrace::converged : ConvergenceTrace::iterate);
+
     } // MGLOQD
     
     // Reset convergence indicator
@@ -436,9 +500,8 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
     // Calculate and print MGHOT residual 
     residualMGHOT = MGQDToMPQD->calcResidual(xLastMGHOTIter,xCurrentIter);
     residualMGHOT = MGQDToMPQD->calcResidual(xCurrentIter,xLastMGHOTIter);
-    cout << "MGHOT Residual: " << residualMGHOT[0];
-    cout << ", " << residualMGHOT[1] << endl;
-    cout << endl;
+    mesh->logger->iteration("MGHOT") << "MGHOT Residual: " << residualMGHOT[0] \
+      << ", " << residualMGHOT[1] << endl << endl;
       
     // Update iterate counters, store residuals
     itersMGHOT++;
@@ -462,24 +525,38 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
         tempResMGHOT.end());
     tempResMGHOT.clear();
       
-    // Check converge criteria 
+    targets = {eps(mpqd->epsMPQD),eps(mpqd->epsMPQD)};
+
+    // Check converge criteria. A predicted step has not seen transport at
+    // the new time until the second pass.
     if (eps(mpqd->epsMPQD) > residualMGHOT[0] and\
-        eps(mpqd->epsMPQD) > residualMGHOT[1]) 
+        eps(mpqd->epsMPQD) > residualMGHOT[1] and\
+        not (predicted and itersMGHOT == 1)) 
     {
       convergedMGHOT = true;
     }
 
+    // The first pass solves only the LO levels
+    trace->record(ConvergenceTrace::levelMGHOT,itersMGHOT-1,residualMGHOT,\
+      targets,eddingtonResidual,mghotSeconds,convergedMGHOT ? \
+      ConvergenceTrace::converged : ConvergenceTrace::iterate);
+    mghotSeconds = 0.0;
+    eddingtonResidual = NAN;
+
   } //MGHOT
     
-  cout << endl;
+  mesh->logger->info("Multilevel") << endl;
   
+  trace->flush();
+
   // Correct MGHOT iteration count. (process starts with MGLOQD solve)
   itersMGHOT = itersMGHOT - 1;
+  lastStepItersMGHOT = itersMGHOT;
    
   // Write iteration countrs to console 
-  cout << "MGHOT iterations: " << itersMGHOT << endl;
-  cout << "MGLOQD iterations: " << itersMGLOQD << endl;
-  cout << "ELOT iterations: " << itersELOT << endl;
+  mesh->logger->info("Multilevel") << "MGHOT iterations: " << itersMGHOT \
+    << endl << "MGLOQD iterations: " << itersMGLOQD << endl \
+    << "ELOT iterations: " << itersELOT << endl;
  
   // Output iteration counts 
   if (outputVars)
@@ -488,6 +565,7 @@ bool MultilevelCoupling::solveOneStepResidualBalance(bool outputVars)
     mesh->output->write(outputDir,"MGLOQD_iters",itersMGLOQD);
     mesh->output->write(outputDir,"ELOT_iters",itersELOT);
     mesh->output->write(outputDir,"iterates",iters);
+    mghotPolicy->writeVars(outputDir);
     mesh->output->write(outputDir,"flux_residuals",fluxResiduals);
     mesh->output->write(outputDir,"temp_residuals",tempResiduals);
     mesh->output->write(outputDir,"MGHOT_Time",mghotDuration);
@@ -516,6 +594,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
   vector<int> iters;
   vector<double> tempResMGHOT,tempResMGLOQD,tempResELOT,tempResiduals;
   vector<double> fluxResMGHOT,fluxResMGLOQD,fluxResELOT,fluxResiduals;
+  vector<double> targets;
+  double mghotSeconds = 0.0,mgloqdSeconds = 0.0,eddingtonResidual = NAN;
   vector<double> kHist;
   double power,kdiff;
  
@@ -554,7 +634,7 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
     if (itersMGHOT != 0 and not p1Approx)
     {
       // Solve MGHOT problem
-      cout << "MGHOT solve...";
+      mesh->logger->info("MGHOT") << "MGHOT solve...";
       //startTime = clock(); 
       auto begin = chrono::high_resolution_clock::now();
       solveSteadyStateMGHOT();
@@ -564,18 +644,22 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
       //duration = (clock() - startTime)/(double)CLOCKS_PER_SEC;
       totalDuration = totalDuration + duration; 
       mghotDuration = mghotDuration + duration; 
-      cout << " done. ("<< duration << " seconds)" << endl;
+      mghotSeconds = duration;
+      mesh->logger->info("MGHOT") << " done. (" << duration << " seconds)" \
+        << endl;
       iters.push_back(3);
 
       // Calculate Eddington factors for MGQD problem
-      cout << "Calculating MGLOQD Eddington factors...";
+      mesh->logger->info("MGLOQD") << "Calculating MGLOQD Eddington factors...";
       eddingtonConverged = MGTToMGQD->calcEddingtonFactors();
-      cout << " done."<< endl;
+      eddingtonResidual = MGTToMGQD->eddingtonResiduals.maxCoeff();
+      mesh->logger->info("MGLOQD") << " done." << endl;
 
       // Calculate BCs for MGQD problem 
-      cout << "Calculating MGLOQD boundary conditions...";
+      mesh->logger->info("MGLOQD") \
+        << "Calculating MGLOQD boundary conditions...";
       MGTToMGQD->calcBCs();
-      cout << " done."<< endl;
+      mesh->logger->info("MGLOQD") << " done." << endl;
     }
 
     // Store last iterate of ELOT solution used in MGHOT level
@@ -589,8 +673,7 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
       /////////////////////
 
       // Solve MGLOQD problem
-      cout << "    ";
-      cout << "MGLOQD solve..." << endl;
+      mesh->logger->info("MGLOQD") << "    MGLOQD solve..." << endl;
       //startTime = clock(); 
       auto begin = chrono::high_resolution_clock::now();
       solveSteadyStateMGLOQD();
@@ -600,8 +683,9 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
       //duration = (clock() - startTime)/(double)CLOCKS_PER_SEC;
       totalDuration = totalDuration + duration; 
       mgloqdDuration = mgloqdDuration + duration; 
-      cout << "    ";
-      cout << "MGLOQD solve done. ("<< duration << " seconds)" << endl;
+      mgloqdSeconds = duration;
+      mesh->logger->info("MGLOQD") << "    MGLOQD solve done. (" << duration \
+        << " seconds)" << endl;
       iters.push_back(2);
 
       // Get group fluxes to use in group collapse
@@ -618,20 +702,18 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
         ///////////////////
 
         // Calculate collapsed nuclear data
-        cout << "        ";
-        cout << "Collapsing MGLOQD data for ELOT solve...";
+        mesh->logger->info("ELOT") \
+          << "        Collapsing MGLOQD data for ELOT solve...";
         MGQDToMPQD->collapseNuclearData();
-        cout << " done."<< endl;
+        mesh->logger->info("ELOT") << " done." << endl;
 
         // Store last iterate of ELOT solution used in ELOT level
-        cout << "        ";
-        cout << "Storing last solution...";
+        mesh->logger->info("ELOT") << "        Storing last solution...";
         xLastELOTIter = mpqd->x;
-        cout << " done."<< endl;
+        mesh->logger->info("ELOT") << " done." << endl;
 
         // Solve ELOT problem
-        cout << "        ";
-        cout << "ELOT solve..." << endl;
+        mesh->logger->info("ELOT") << "        ELOT solve..." << endl;
         //startTime = clock(); 
         auto begin = chrono::high_resolution_clock::now();
         solveSteadyStateELOT(mpqd->x);
@@ -641,8 +723,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
         //duration = (clock() - startTime)/(double)CLOCKS_PER_SEC;
         totalDuration = totalDuration + duration; 
         elotDuration = elotDuration + duration; 
-        cout << "        ";
-        cout << "ELOT solve done. ("<< duration << " seconds)" << endl;
+        mesh->logger->info("ELOT") << "        ELOT solve done. (" << duration \
+          << " seconds)" << endl;
         iters.push_back(1);
 
         // Store newest iterate 
@@ -653,9 +735,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
         // Calculate and print ELOT residual  
         residualELOT = MGQDToMPQD->calcResidual(xLastELOTIter,xCurrentIter);
         residualELOT = MGQDToMPQD->calcResidual(xCurrentIter,xLastELOTIter);
-        cout << "        ";
-        cout << "ELOT Residual: " << residualELOT[0]; 
-        cout << ", " << residualELOT[1] << endl;
+        mesh->logger->iteration("ELOT") << "        ELOT Residual: " \
+          << residualELOT[0] << ", " << residualELOT[1] << endl;
 
         // Update iterate counters, store residuals
         itersELOT++;
@@ -687,10 +768,9 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
         mpqd->ggqd->sFlux = (ratedPower/power)*mpqd->ggqd->sFlux;
 
         // Print eigenvalue 
-        cout << "        ";
-        cout << "k: " << setprecision(10) <<mats->oneGroupXS->keff;
-        cout << setprecision(6) <<scientific << endl;
-        cout << endl;
+        mesh->logger->info("Multilevel") << "        k: " << setprecision(10) \
+          << mats->oneGroupXS->keff << setprecision(6) << scientific << endl \
+          << endl;
 
         // Calculate difference in past and current eigenvalue
         kdiff = abs(mats->oneGroupXS->kold - mats->oneGroupXS->keff);
@@ -698,11 +778,18 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
         // Update temperature to evaluate nuclear data at
         mats->updateTemperature(mpqd->heat->returnCurrentTemp());
 
+        // Thresholds this iterate is checked against
+        targets = {eps(residualMGLOQD[0],relaxTolELOT),\
+          eps(residualMGLOQD[1],relaxTolELOT)};
+
         // Check if residuals are too big or if the residuals have increased
         // from the last MGLOQD residual 
         if (residualELOT[0]/lastResidualELOT[0] > resetThreshold and\
             residualELOT[1]/lastResidualELOT[1] > resetThreshold) 
         {
+          trace->record(ConvergenceTrace::levelELOT,itersELOT,residualELOT,\
+            targets,NAN,duration,ConvergenceTrace::reset);
+
           // Jump back to MGLOQD level
           break;
         }
@@ -716,6 +803,10 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
           convergedELOT = true;
         }
 
+        trace->record(ConvergenceTrace::levelELOT,itersELOT,residualELOT,\
+          targets,NAN,duration,convergedELOT ? ConvergenceTrace::converged \
+          : ConvergenceTrace::iterate);
+
         // Check keff converge criteria 
         if (abs(mats->oneGroupXS->keff - mats->oneGroupXS->kold) < 1E-10) 
         {
@@ -734,11 +825,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
       // Calculate and print MGLOQD residual 
       residualMGLOQD = MGQDToMPQD->calcResidual(xLastMGLOQDIter,xCurrentIter);
       residualMGLOQD = MGQDToMPQD->calcResidual(xCurrentIter,xLastMGLOQDIter);
-      cout << endl;
-      cout << "    ";
-      cout << "MGLOQD Residual: " << residualMGLOQD[0];
-      cout << ", " << residualMGLOQD[1] << endl;
-      cout << endl;
+      mesh->logger->iteration("MGLOQD") << endl << "    MGLOQD Residual: " \
+        << residualMGLOQD[0] << ", " << residualMGLOQD[1] << endl << endl;
 
       // Update iterate counters, store residuals
       itersMGLOQD++;
@@ -753,11 +841,18 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
           tempResELOT.begin(),tempResELOT.end());
       tempResELOT.clear();
 
+      // Thresholds this iterate is checked against
+      targets = {eps(residualMGHOT[0],relaxTolMGLOQD),\
+        eps(residualMGHOT[1],relaxTolMGLOQD)};
+
       // Check if residuals are too big or if the residuals have increased
       // from the last MGLOQD residual 
       if (residualMGLOQD[0]/lastResidualMGLOQD[0] > resetThreshold or\
           residualMGLOQD[1]/lastResidualMGLOQD[1] > resetThreshold)
       {
+        trace->record(ConvergenceTrace::levelMGLOQD,itersMGLOQD,residualMGLOQD,\
+          targets,NAN,mgloqdSeconds,ConvergenceTrace::reset);
+
         // Jump back to MGHOT level
         break;
       }
@@ -769,6 +864,10 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
         convergedMGLOQD = true;
       }
 
+      trace->record(ConvergenceTrace::levelMGLOQD,itersMGLOQD,residualMGLOQD,\
+        targets,NAN,mgloqdSeconds,convergedMGLOQD ? \
+        ConvergenceTrace::converged : ConvergenceTrace::iterate);
+
     } // MGLOQD
 
     // Reset convergence indicator
@@ -777,9 +876,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
     // Calculate and print MGHOT residual 
     residualMGHOT = MGQDToMPQD->calcResidual(xLastMGHOTIter,xCurrentIter);
     residualMGHOT = MGQDToMPQD->calcResidual(xCurrentIter,xLastMGHOTIter);
-    cout << "MGHOT Residual: " << residualMGHOT[0];
-    cout << ", " << residualMGHOT[1] << endl;
-    cout << endl;
+    mesh->logger->iteration("MGHOT") << "MGHOT Residual: " << residualMGHOT[0] \
+      << ", " << residualMGHOT[1] << endl << endl;
 
     // Update iterate counters, store residuals
     itersMGHOT++;
@@ -803,6 +901,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
         tempResMGHOT.end());
     tempResMGHOT.clear();
 
+    targets = {eps(mpqd->epsMPQD),eps(mpqd->epsMPQD)};
+
     // Check converge criteria 
     if (eps(mpqd->epsMPQD) > residualMGHOT[0] and\
         eps(mpqd->epsMPQD) > residualMGHOT[1] and\
@@ -811,6 +911,13 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
       convergedMGHOT = true;
     }
 
+    // The first pass solves only the LO levels
+    trace->record(ConvergenceTrace::levelMGHOT,itersMGHOT-1,residualMGHOT,\
+      targets,eddingtonResidual,mghotSeconds,convergedMGHOT ? \
+      ConvergenceTrace::converged : ConvergenceTrace::iterate);
+    mghotSeconds = 0.0;
+    eddingtonResidual = NAN;
+
   } //MGHOT
 
 
@@ -821,12 +928,14 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
   mgqd->writeVars(); 
   mats->oneGroupXS->writeVars();
   
+  trace->flush();
+
   // Correct MGHOT iteration count. (process starts with MGLOQD solve)
   itersMGHOT = itersMGHOT - 1;
 
-  cout << "MGHOT iterations: " << itersMGHOT << endl;
-  cout << "MGLOQD iterations: " << itersMGLOQD << endl;
-  cout << "ELOT iterations: " << itersELOT << endl;
+  mesh->logger->info("Multilevel") << "MGHOT iterations: " << itersMGHOT \
+    << endl << "MGLOQD iterations: " << itersMGLOQD << endl \
+    << "ELOT iterations: " << itersELOT << endl;
  
   // Output iteration counts 
   if (outputVars)
@@ -850,9 +959,21 @@ void MultilevelCoupling::solveSteadyStateResidualBalance(bool outputVars)
 //==============================================================================
 void MultilevelCoupling::solveSteadyStateTransientResidualBalance(bool outputVars)
 {
-  mesh->state=0;
-  solveSteadyStateResidualBalance(outputVars);
-  mesh->advanceOneTimeStep();
+  // A restarted transient picks up from the checkpointed state instead
+  if (restartFile.empty())
+  {
+    mesh->state=0;
+    if (not readSteadyStateCache(outputVars))
+    {
+      solveSteadyStateResidualBalance(outputVars);
+      storeSolutionHistory(true);
+      writeSteadyStateCache();
+    }
+    diagnostics->evaluate();
+    mesh->profiler->endStep();
+    mesh->logger->flush();
+    mesh->advanceOneTimeStep();
+  }
   solveTransient();
 }
 //==============================================================================
@@ -922,17 +1043,97 @@ double MultilevelCoupling::relaxedEpsK(double residual, double relaxationToleran
 void MultilevelCoupling::solveMGHOT()
 {
 
+  ScopedTimer timer(mesh->profiler,"MGHOT");
+
   // Calculate transport sources
   mgt->calcSources();
 
   // Calculate transport alphas
   mgt->calcAlphas();
 
-  // Solve starting angle transport problem
-  mgt->solveStartAngles();
+  // Sweep on the coarse mesh and interpolate back, if one is set
+  if (coarseMGHOT->enabled)
+  {
+    coarseMGHOT->solve(mghotPolicy->solveGroup);
+    return;
+  }
 
-  // Solve all angle transport problem
-  mgt->solveSCBs();
+  // Solve starting angle transport problem in groups selected by the policy
+  mgt->solveStartAngles(mghotPolicy->solveGroup);
+
+  // Solve all angle transport problem in groups selected by the policy
+  mgt->solveSCBs(mghotPolicy->solveGroup);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Perform a solve at the MGHOT level as a task graph over energy groups.
+/// The Eddington factors and boundary conditions of each group are computed
+/// as soon as its sweeps finish, while later groups are still sweeping.
+///
+/// @param [out] eddingtonConverged whether the Eddington factors of every
+///   group passed the convergence criteria
+bool MultilevelCoupling::solveMGHOTPipelined()
+{
+
+  int nGroups = mgt->SGTs.size();
+  VectorXb solveGroup = mghotPolicy->solveGroup;
+  bool eddingtonConverged = true;
+
+  // One dependency token per group, and char rather than bool so tasks can
+  // write their own entry
+  vector<char> swept(nGroups),converged(nGroups,true);
+  char * sweptToken = swept.data();
+
+  ScopedTimer timer(mesh->profiler,"MGHOT");
+
+  // Tasks may run on threads that do not see the timers open on this one, so
+  // they time themselves under full paths
+  string groupPath = mesh->profiler->currentPath() + "/group";
+  string eddingtonPath = mesh->profiler->currentPath() + "/eddington";
+
+  // Sources and alphas couple the groups, so they are computed up front
+  mgt->calcSources();
+  mgt->calcAlphas();
+  if (coarseMGHOT->enabled)
+    coarseMGHOT->restrictState();
+
+  #pragma omp parallel num_threads(mesh->scheduler->threads(Scheduler::sweep))
+  #pragma omp single
+  {
+    for (int iGroup = 0; iGroup < nGroups; iGroup++)
+    {
+      // Sweep the starting angle and then all angles of the group
+      if (solveGroup(iGroup))
+      {
+        #pragma omp task firstprivate(iGroup) depend(out:sweptToken[iGroup])
+        {
+          ScopedTimer timer(mesh->profiler,groupPath.c_str());
+          if (coarseMGHOT->enabled)
+            coarseMGHOT->sweepGroup(iGroup);
+          else
+          {
+            mgt->SGTs[iGroup]->solveStartAngle();
+            mgt->SGTs[iGroup]->solveSCB();
+          }
+        }
+      }
+
+      // Couple the group to the MGLOQD once its sweep is done
+      #pragma omp task firstprivate(iGroup) depend(in:sweptToken[iGroup])
+      {
+        ScopedTimer timer(mesh->profiler,eddingtonPath.c_str());
+        converged[iGroup] = MGTToMGQD->calcEddingtonFactors(iGroup,iGroup+1);
+        MGTToMGQD->calcBCs(iGroup,iGroup+1);
+      }
+    }
+  }
+
+  for (int iGroup = 0; iGroup < nGroups; iGroup++)
+    eddingtonConverged = eddingtonConverged and converged[iGroup];
+
+  return eddingtonConverged;
 
 };
 //==============================================================================
@@ -943,12 +1144,21 @@ void MultilevelCoupling::solveMGHOT()
 void MultilevelCoupling::solveSteadyStateMGHOT()
 {
 
+  ScopedTimer timer(mesh->profiler,"MGHOT");
+
   // Calculate transport sources
   mgt->calcSources("steady_state");
 
   // Calculate transport alphas
   mgt->calcAlphas("noPrint","steady_state");
 
+  // Sweep on the coarse mesh and interpolate back, if one is set
+  if (coarseMGHOT->enabled)
+  {
+    coarseMGHOT->solve();
+    return;
+  }
+
   // Solve starting angle transport problem
   mgt->solveStartAngles();
 
@@ -965,20 +1175,34 @@ void MultilevelCoupling::solveSteadyStateMGHOT()
 void MultilevelCoupling::solveMGLOQD()
 {
 
+  ScopedTimer timer(mesh->profiler,"MGLOQD");
+  trace->beginSolve();
+
   // Build flux system
-  mgqd->buildLinearSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"assemble");
+    mgqd->buildLinearSystem();
+  }
   
   // Solve flux system
-  if (iterativeMGLOQD)
-    mgqd->solveLinearSystemIterative();
-  else
-    mgqd->solveLinearSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"solve");
+    if (iterativeMGLOQD)
+      mgqd->solveLinearSystemIterative();
+    else
+      mgqd->solveLinearSystem();
+  }
 
   // Build neutron current system
-  mgqd->buildBackCalcSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"backCalc");
+    mgqd->buildBackCalcSystem();
 
-  // Solve neutron current system
-  mgqd->backCalculateCurrent();
+    // Solve neutron current system
+    mgqd->backCalculateCurrent();
+  }
+
+  trace->endSolve(ConvergenceTrace::levelMGLOQD);
 
 };
 //==============================================================================
@@ -989,20 +1213,34 @@ void MultilevelCoupling::solveMGLOQD()
 void MultilevelCoupling::solveSteadyStateMGLOQD()
 {
 
+  ScopedTimer timer(mesh->profiler,"MGLOQD");
+  trace->beginSolve();
+
   // Build flux system
-  mgqd->buildSteadyStateLinearSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"assemble");
+    mgqd->buildSteadyStateLinearSystem();
+  }
 
   // Solve flux system
-  if (iterativeMGLOQD)
-    mgqd->solveLinearSystemIterative();
-  else
-    mgqd->solveLinearSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"solve");
+    if (iterativeMGLOQD)
+      mgqd->solveLinearSystemIterative();
+    else
+      mgqd->solveLinearSystem();
+  }
 
   // Build neutron current system
-  mgqd->buildSteadyStateBackCalcSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"backCalc");
+    mgqd->buildSteadyStateBackCalcSystem();
 
-  // Solve neutron current system
-  mgqd->backCalculateCurrent();
+    // Solve neutron current system
+    mgqd->backCalculateCurrent();
+  }
+
+  trace->endSolve(ConvergenceTrace::levelMGLOQD);
 
 };
 //==============================================================================
@@ -1014,18 +1252,81 @@ void MultilevelCoupling::solveSteadyStateMGLOQD()
 void MultilevelCoupling::solveELOT(Eigen::VectorXd xGuess)
 {
 
+  ScopedTimer timer(mesh->profiler,"ELOT");
+  trace->beginSolve();
+
   // Build ELOT system
-  mpqd->buildLinearSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"assemble");
+    mpqd->buildLinearSystem();
+  }
 
   // Solve ELOT system
-  if (iterativeELOT)
-    mpqd->solveLinearSystemIterative(xGuess);
-  else
-    mpqd->solveLinearSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"solve");
+    if (iterativeELOT)
+      mpqd->solveLinearSystemIterative(xGuess);
+    else
+      mpqd->solveLinearSystem();
+  }
   
   //cout << "ELOT x" << endl;
   //cout << mpqd->x << endl;
 
+  trace->endSolve(ConvergenceTrace::levelELOT);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Replace the ELOT and MGLOQD solution vectors with predictors extrapolated
+/// from previous time steps. These serve as initial guesses for iterative
+/// solves and as the first ELOT iterate seen by the MGLOQD level.
+///
+/// @return whether a predictor replaced the solution vectors
+bool MultilevelCoupling::predictInitialGuess()
+{
+
+  double time = mesh->ts[mesh->state];
+
+  if (not elotHistory->ready())
+    return false;
+
+  mpqd->x = elotHistory->extrapolate(time);
+
+  if (mgloqdHistory->ready())
+    mgqd->QDSolve->x = mgloqdHistory->extrapolate(time);
+
+  // Use predicted temperatures to evaluate the first set of cross sections
+  if (predictTemperature)
+    mats->updateTemperature(mpqd->heat->returnCurrentTemp());
+
+  return true;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Store converged ELOT and MGLOQD solutions for later extrapolation
+///
+/// @param [in] reset discard previously stored solutions first 
+void MultilevelCoupling::storeSolutionHistory(bool reset)
+{
+
+  double time = mesh->ts[mesh->state];
+
+  if (extrapolationOrder == 0)
+    return;
+
+  if (reset)
+  {
+    elotHistory->clear();
+    mgloqdHistory->clear();
+  }
+
+  elotHistory->push(time,mpqd->x);
+  mgloqdHistory->push(time,mgqd->QDSolve->x);
+
 };
 //==============================================================================
 
@@ -1035,14 +1336,25 @@ void MultilevelCoupling::solveELOT(Eigen::VectorXd xGuess)
 void MultilevelCoupling::solveSteadyStateELOT(Eigen::VectorXd xGuess)
 {
 
+  ScopedTimer timer(mesh->profiler,"ELOT");
+  trace->beginSolve();
+
   // Build ELOT system
-  mpqd->buildSteadyStateLinearSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"assemble");
+    mpqd->buildSteadyStateLinearSystem();
+  }
 
   // Solve ELOT system
-  if (iterativeELOT)
-    mpqd->solveLinearSystemIterative(xGuess);
-  else
-    mpqd->solveLinearSystem();
+  {
+    ScopedTimer timer(mesh->profiler,"solve");
+    if (iterativeELOT)
+      mpqd->solveLinearSystemIterative(xGuess);
+    else
+      mpqd->solveLinearSystem();
+  }
+
+  trace->endSolve(ConvergenceTrace::levelELOT);
 
 };
 //==============================================================================
@@ -1061,19 +1373,31 @@ void MultilevelCoupling::solveTransient()
   mesh->writeVars();
 
   // Initialize solve 
-  cout << "Computing initial solve..." << endl;
-  cout << endl;
+  mesh->logger->info("Multilevel") << "Computing initial solve..." << endl \
+    << endl;
   //MGQDToMPQD->solveOneStep();
   //initialSolve();
-  cout << "Initial solve completed." << endl;
-  cout << endl;
+  mesh->logger->info("Multilevel") << "Initial solve completed." << endl \
+    << endl;
 
   auto outerBegin = chrono::high_resolution_clock::now();
 
-  for (int iTime = 0; iTime < mesh->dts.size(); iTime++)
+  // Load checkpointed state if restarting
+  if (not restartFile.empty())
+  {
+    if (not readCheckpoint(restartFile))
+    {
+      mesh->logger->warning("Multilevel") << "Transient aborted." << endl;
+      return;
+    }
+    mesh->logger->info("Multilevel") << "Restarting from t = " \
+      << mesh->ts[mesh->state-1] << endl << endl;
+  }
+
+  for (int iTime = mesh->state-1; iTime < mesh->dts.size(); iTime++)
   {
-    cout << "Solve for t = "<< mesh->ts[iTime+1] << endl;
-    cout << endl;
+    mesh->logger->info("Multilevel") << "Solve for t = " << mesh->ts[iTime+1] \
+      << endl << endl;
 
     //startTime = clock(); 
     auto begin = chrono::high_resolution_clock::now();
@@ -1085,11 +1409,16 @@ void MultilevelCoupling::solveTransient()
       auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
       duration = elapsed.count()*1e-9;
       totalDuration = totalDuration + duration; 
-      cout << "Solution computed in " << duration << " seconds." << endl;      
+      mesh->logger->info("Multilevel") << "Solution computed in " << duration \
+        << " seconds." << endl;
 
       // Output and update variables
       mgqd->updateVarsAfterConvergence(); 
       mpqd->updateVarsAfterConvergence(); 
+      storeSolutionHistory();
+      diagnostics->evaluate();
+      mesh->profiler->endStep();
+      mesh->logger->flush();
       if (mesh->outputOnStep[iTime])
       {
         mgqd->writeVars();
@@ -1098,6 +1427,8 @@ void MultilevelCoupling::solveTransient()
         mesh->output->write(outputDir,"Solve_Time",duration);
       }
       mesh->advanceOneTimeStep();
+      if (checkpointInterval > 0 and (mesh->state-1)%checkpointInterval == 0)
+        writeCheckpoint(checkpointFile);
     }  
     else 
     {
@@ -1107,22 +1438,26 @@ void MultilevelCoupling::solveTransient()
       auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
       duration = elapsed.count()*1e-9;
       totalDuration = totalDuration + duration; 
-      cout << "Solution aborted after " << duration << " seconds." << endl;      
+      mesh->logger->warning("Multilevel") << "Solution aborted after " \
+        << duration << " seconds." << endl;
       mesh->output->write(outputDir,"Solve_Time",duration);
 
-      cout << "Solve not converged." << endl;
-      cout << "Transient aborted." << endl;
+      mesh->logger->warning("Multilevel") << "Solve not converged." << endl \
+        << "Transient aborted." << endl;
       break;
     }
   } 
   auto outerEnd = chrono::high_resolution_clock::now();
   auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(outerEnd - outerBegin);
   duration = elapsed.count()*1e-9;
-  cout << "Outer solve time: " << duration << " seconds." << endl;      
+  mesh->logger->info("Multilevel") << "Outer solve time: " << duration \
+    << " seconds." << endl;
 
   // Report total solve time
-  cout << "Total solve time: " << totalDuration << " seconds." << endl;      
+  mesh->logger->info("Multilevel") << "Total solve time: " << totalDuration \
+    << " seconds." << endl;
   mesh->output->write(outputDir,"Solve_Time",duration,true);
+  mesh->logger->flush();
 
 };
 //==============================================================================
@@ -1147,6 +1482,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
   vector<int> iters;
   vector<double> tempResMGHOT,tempResMGLOQD,tempResELOT,tempResiduals;
   vector<double> fluxResMGHOT,fluxResMGLOQD,fluxResELOT,fluxResiduals;
+  vector<double> targets;
+  double mghotSeconds = 0.0,mgloqdSeconds = 0.0,eddingtonResidual = NAN;
   vector<double> kHist;
   double power,kdiff;
  
@@ -1185,7 +1522,7 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
     if (itersMGHOT != 0 and not p1Approx)
     {
       // Solve MGHOT problem
-      cout << "MGHOT solve...";
+      mesh->logger->info("MGHOT") << "MGHOT solve...";
       //startTime = clock(); 
       auto begin = chrono::high_resolution_clock::now();
       solveSteadyStateMGHOT();
@@ -1195,18 +1532,22 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
       duration = elapsed.count()*1e-9;
       totalDuration = totalDuration + duration; 
       mghotDuration = mghotDuration + duration; 
-      cout << " done. ("<< duration << " seconds)" << endl;
+      mghotSeconds = duration;
+      mesh->logger->info("MGHOT") << " done. (" << duration << " seconds)" \
+        << endl;
       iters.push_back(3);
 
       // Calculate Eddington factors for MGQD problem
-      cout << "Calculating MGLOQD Eddington factors...";
+      mesh->logger->info("MGLOQD") << "Calculating MGLOQD Eddington factors...";
       eddingtonConverged = MGTToMGQD->calcEddingtonFactors();
-      cout << " done."<< endl;
+      eddingtonResidual = MGTToMGQD->eddingtonResiduals.maxCoeff();
+      mesh->logger->info("MGLOQD") << " done." << endl;
 
       // Calculate BCs for MGQD problem 
-      cout << "Calculating MGLOQD boundary conditions...";
+      mesh->logger->info("MGLOQD") \
+        << "Calculating MGLOQD boundary conditions...";
       MGTToMGQD->calcBCs();
-      cout << " done."<< endl;
+      mesh->logger->info("MGLOQD") << " done." << endl;
     }
 
     // Store last iterate of ELOT solution used in MGHOT level
@@ -1222,8 +1563,7 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
       /////////////////////
 
       // Solve MGLOQD problem
-      cout << "    ";
-      cout << "MGLOQD solve..." << endl;
+      mesh->logger->info("MGLOQD") << "    MGLOQD solve..." << endl;
       //startTime = clock(); 
       auto begin = chrono::high_resolution_clock::now();
       solveSteadyStateMGLOQD_p();
@@ -1233,8 +1573,9 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
       duration = elapsed.count()*1e-9;
       totalDuration = totalDuration + duration; 
       mgloqdDuration = mgloqdDuration + duration; 
-      cout << "    ";
-      cout << "MGLOQD solve done. ("<< duration << " seconds)" << endl;
+      mgloqdSeconds = duration;
+      mesh->logger->info("MGLOQD") << "    MGLOQD solve done. (" << duration \
+        << " seconds)" << endl;
       iters.push_back(2);
 
       // Get group fluxes to use in group collapse
@@ -1252,21 +1593,19 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
         ///////////////////
 
         // Calculate collapsed nuclear data
-        cout << "        ";
-        cout << "Collapsing MGLOQD data for ELOT solve...";
+        mesh->logger->info("ELOT") \
+          << "        Collapsing MGLOQD data for ELOT solve...";
         MGQDToMPQD->collapseNuclearData();
-        cout << " done."<< endl;
+        mesh->logger->info("ELOT") << " done." << endl;
 
         // Store last iterate of ELOT solution used in ELOT level
-        cout << "        ";
-        cout << "Storing last solution...";
+        mesh->logger->info("ELOT") << "        Storing last solution...";
         //xLastELOTIter = mpqd->x_p;
         petscVecToEigenVec(&(mpqd->x_p),&xLastELOTIter);
-        cout << " done."<< endl;
+        mesh->logger->info("ELOT") << " done." << endl;
 
         // Solve ELOT problem
-        cout << "        ";
-        cout << "ELOT solve..." << endl;
+        mesh->logger->info("ELOT") << "        ELOT solve..." << endl;
         //startTime = clock(); 
         auto begin = chrono::high_resolution_clock::now();
         solveSteadyStateELOT_p();
@@ -1276,8 +1615,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
         duration = elapsed.count()*1e-9;
         totalDuration = totalDuration + duration; 
         elotDuration = elotDuration + duration; 
-        cout << "        ";
-        cout << "ELOT solve done. ("<< duration << " seconds)" << endl;
+        mesh->logger->info("ELOT") << "        ELOT solve done. (" << duration \
+          << " seconds)" << endl;
         iters.push_back(1);
 
         // Store newest iterate 
@@ -1290,9 +1629,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
         
         residualELOT = MGQDToMPQD->calcResidual(xLastELOTIter,xCurrentIter);
         residualELOT = MGQDToMPQD->calcResidual(xCurrentIter,xLastELOTIter);
-        cout << "        ";
-        cout << "ELOT Residual: " << residualELOT[0]; 
-        cout << ", " << residualELOT[1] << endl;
+        mesh->logger->iteration("ELOT") << "        ELOT Residual: " \
+          << residualELOT[0] << ", " << residualELOT[1] << endl;
 
         // Update iterate counters, store residuals
         itersELOT++;
@@ -1324,10 +1662,9 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
         mpqd->ggqd->sFlux = (ratedPower/power)*mpqd->ggqd->sFlux;
 
         // Print eigenvalue 
-        cout << "        ";
-        cout << "k: " << setprecision(10) <<mats->oneGroupXS->keff;
-        cout << setprecision(6) <<scientific << endl;
-        cout << endl;
+        mesh->logger->info("Multilevel") << "        k: " << setprecision(10) \
+          << mats->oneGroupXS->keff << setprecision(6) << scientific << endl \
+          << endl;
 
         // Calculate difference in past and current eigenvalue
         kdiff = abs(mats->oneGroupXS->kold - mats->oneGroupXS->keff);
@@ -1335,11 +1672,18 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
         // Update temperature to evaluate nuclear data at
         mats->updateTemperature(mpqd->heat->returnCurrentTemp());
 
+        // Thresholds this iterate is checked against
+        targets = {eps(residualMGLOQD[0],relaxTolELOT),\
+          eps(residualMGLOQD[1],relaxTolELOT)};
+
         // Check if residuals are too big or if the residuals have increased
         // from the last MGLOQD residual 
         if (residualELOT[0]/lastResidualELOT[0] > resetThreshold and\
             residualELOT[1]/lastResidualELOT[1] > resetThreshold) 
         {
+          trace->record(ConvergenceTrace::levelELOT,itersELOT,residualELOT,\
+            targets,NAN,duration,ConvergenceTrace::reset);
+
           // Jump back to MGLOQD level
           break;
           
@@ -1354,6 +1698,10 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
           convergedELOT = true;
         }
 
+        trace->record(ConvergenceTrace::levelELOT,itersELOT,residualELOT,\
+          targets,NAN,duration,convergedELOT ? ConvergenceTrace::converged \
+          : ConvergenceTrace::iterate);
+
         // Check keff converge criteria 
         if (abs(mats->oneGroupXS->keff - mats->oneGroupXS->kold) < 1E-10) 
         {
@@ -1372,11 +1720,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
       // Calculate and print MGLOQD residual 
       residualMGLOQD = MGQDToMPQD->calcResidual(xLastMGLOQDIter,xCurrentIter);
       residualMGLOQD = MGQDToMPQD->calcResidual(xCurrentIter,xLastMGLOQDIter);
-      cout << endl;
-      cout << "    ";
-      cout << "MGLOQD Residual: " << residualMGLOQD[0];
-      cout << ", " << residualMGLOQD[1] << endl;
-      cout << endl;
+      mesh->logger->iteration("MGLOQD") << endl << "    MGLOQD Residual: " \
+        << residualMGLOQD[0] << ", " << residualMGLOQD[1] << endl << endl;
 
       // Update iterate counters, store residuals
       itersMGLOQD++;
@@ -1391,11 +1736,18 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
           tempResELOT.begin(),tempResELOT.end());
       tempResELOT.clear();
 
+      // Thresholds this iterate is checked against
+      targets = {eps(residualMGHOT[0],relaxTolMGLOQD),\
+        eps(residualMGHOT[1],relaxTolMGLOQD)};
+
       // Check if residuals are too big or if the residuals have increased
       // from the last MGLOQD residual 
       if (residualMGLOQD[0]/lastResidualMGLOQD[0] > resetThreshold or\
           residualMGLOQD[1]/lastResidualMGLOQD[1] > resetThreshold)
       {
+        trace->record(ConvergenceTrace::levelMGLOQD,itersMGLOQD,residualMGLOQD,\
+          targets,NAN,mgloqdSeconds,ConvergenceTrace::reset);
+
         // Jump back to MGHOT level
         break;
       }
@@ -1407,6 +1759,10 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
         convergedMGLOQD = true;
       }
 
+      trace->record(ConvergenceTrace::levelMGLOQD,itersMGLOQD,residualMGLOQD,\
+        targets,NAN,mgloqdSeconds,convergedMGLOQD ? \
+        ConvergenceTrace::converged : ConvergenceTrace::iterate);
+
     } // MGLOQD
 
     // Reset convergence indicator
@@ -1415,9 +1771,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
     // Calculate and print MGHOT residual 
     residualMGHOT = MGQDToMPQD->calcResidual(xLastMGHOTIter,xCurrentIter);
     residualMGHOT = MGQDToMPQD->calcResidual(xCurrentIter,xLastMGHOTIter);
-    cout << "MGHOT Residual: " << residualMGHOT[0];
-    cout << ", " << residualMGHOT[1] << endl;
-    cout << endl;
+    mesh->logger->iteration("MGHOT") << "MGHOT Residual: " << residualMGHOT[0] \
+      << ", " << residualMGHOT[1] << endl << endl;
 
     // Update iterate counters, store residuals
     itersMGHOT++;
@@ -1441,6 +1796,8 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
         tempResMGHOT.end());
     tempResMGHOT.clear();
 
+    targets = {eps(mpqd->epsMPQD),eps(mpqd->epsMPQD)};
+
     // Check converge criteria 
     if (eps(mpqd->epsMPQD) > residualMGHOT[0] and\
         eps(mpqd->epsMPQD) > residualMGHOT[1] and\
@@ -1449,6 +1806,13 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
       convergedMGHOT = true;
     }
 
+    // The first pass solves only the LO levels
+    trace->record(ConvergenceTrace::levelMGHOT,itersMGHOT-1,residualMGHOT,\
+      targets,eddingtonResidual,mghotSeconds,convergedMGHOT ? \
+      ConvergenceTrace::converged : ConvergenceTrace::iterate);
+    mghotSeconds = 0.0;
+    eddingtonResidual = NAN;
+
   } //MGHOT
 
 
@@ -1459,12 +1823,14 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
   mgqd->writeVars(); 
   mats->oneGroupXS->writeVars();
   
+  trace->flush();
+
   // Correct MGHOT iteration count. (process starts with MGLOQD solve)
   itersMGHOT = itersMGHOT - 1;
 
-  cout << "MGHOT iterations: " << itersMGHOT << endl;
-  cout << "MGLOQD iterations: " << itersMGLOQD << endl;
-  cout << "ELOT iterations: " << itersELOT << endl;
+  mesh->logger->info("Multilevel") << "MGHOT iterations: " << itersMGHOT \
+    << endl << "MGLOQD iterations: " << itersMGLOQD << endl \
+    << "ELOT iterations: " << itersELOT << endl;
  
   // Output iteration counts 
   if (outputVars)
@@ -1491,17 +1857,31 @@ void MultilevelCoupling::solveSteadyStateResidualBalance_p(bool outputVars)
 void MultilevelCoupling::solveSteadyStateMGLOQD_p()
 {
 
+  ScopedTimer timer(mesh->profiler,"MGLOQD");
+  trace->beginSolve();
+
   // Build flux system
-  mgqd->buildSteadyStateLinearSystem_p();
+  {
+    ScopedTimer timer(mesh->profiler,"assemble");
+    mgqd->buildSteadyStateLinearSystem_p();
+  }
 
   // Solve flux system
-  mgqd->solveLinearSystem_p();
+  {
+    ScopedTimer timer(mesh->profiler,"solve");
+    mgqd->solveLinearSystem_p();
+  }
 
   // Build neutron current system
-  mgqd->buildSteadyStateBackCalcSystem_p();
+  {
+    ScopedTimer timer(mesh->profiler,"backCalc");
+    mgqd->buildSteadyStateBackCalcSystem_p();
+
+    // Solve neutron current system
+    mgqd->backCalculateCurrent_p();
+  }
 
-  // Solve neutron current system
-  mgqd->backCalculateCurrent_p();
+  trace->endSolve(ConvergenceTrace::levelMGLOQD);
 
 };
 //==============================================================================
@@ -1512,11 +1892,23 @@ void MultilevelCoupling::solveSteadyStateMGLOQD_p()
 void MultilevelCoupling::solveSteadyStateELOT_p()
 {
 
+  ScopedTimer timer(mesh->profiler,"ELOT");
+  trace->beginSolve();
+
   // Build ELOT system
-  mpqd->buildSteadyStateLinearSystem_p();
+  {
+    ScopedTimer timer(mesh->profiler,"assemble");
+    mpqd->buildSteadyStateLinearSystem_p();
+  }
 
   // Solve ELOT system
-  mpqd->solve_p();
+  {
+    ScopedTimer timer(mesh->profiler,"solve");
+    mpqd->solve_p();
+  }
+
+  trace->endSolve(ConvergenceTrace::levelELOT);
+
 };
 //==============================================================================
 
@@ -1525,9 +1917,21 @@ void MultilevelCoupling::solveSteadyStateELOT_p()
 //==============================================================================
 void MultilevelCoupling::solveSteadyStateTransientResidualBalance_p(bool outputVars)
 {
-  mesh->state=0;
-  solveSteadyStateResidualBalance_p(outputVars);
-  mesh->advanceOneTimeStep();
+  // A restarted transient picks up from the checkpointed state instead
+  if (restartFile.empty())
+  {
+    mesh->state=0;
+    if (not readSteadyStateCache(outputVars))
+    {
+      solveSteadyStateResidualBalance_p(outputVars);
+      storeSolutionHistory_p(true);
+      writeSteadyStateCache();
+    }
+    diagnostics->evaluate();
+    mesh->profiler->endStep();
+    mesh->logger->flush();
+    mesh->advanceOneTimeStep();
+  }
   solveTransient_p();
 }
 //==============================================================================
@@ -1547,10 +1951,22 @@ void MultilevelCoupling::solveTransient_p()
   
   auto outerBegin = chrono::high_resolution_clock::now();
 
-  for (int iTime = 0; iTime < mesh->dts.size(); iTime++)
+  // Load checkpointed state if restarting
+  if (not restartFile.empty())
   {
-    cout << "Solve for t = "<< mesh->ts[iTime+1] << endl;
-    cout << endl;
+    if (not readCheckpoint(restartFile))
+    {
+      mesh->logger->warning("Multilevel") << "Transient aborted." << endl;
+      return;
+    }
+    mesh->logger->info("Multilevel") << "Restarting from t = " \
+      << mesh->ts[mesh->state-1] << endl << endl;
+  }
+
+  for (int iTime = mesh->state-1; iTime < mesh->dts.size(); iTime++)
+  {
+    mesh->logger->info("Multilevel") << "Solve for t = " << mesh->ts[iTime+1] \
+      << endl << endl;
 
     auto begin = chrono::high_resolution_clock::now();
     if(solveOneStepResidualBalance_p(mesh->outputOnStep[iTime]))
@@ -1560,11 +1976,16 @@ void MultilevelCoupling::solveTransient_p()
       auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
       duration = elapsed.count()*1e-9;
       totalDuration = totalDuration + duration; 
-      cout << "Solution computed in " << duration << " seconds." << endl;      
+      mesh->logger->info("Multilevel") << "Solution computed in " << duration \
+        << " seconds." << endl;
 
       // Output and update variables
       mgqd->updateVarsAfterConvergence(); 
       mpqd->updateVarsAfterConvergence_p(); 
+      storeSolutionHistory_p();
+      diagnostics->evaluate();
+      mesh->profiler->endStep();
+      mesh->logger->flush();
       if (mesh->outputOnStep[iTime])
       {
         mgqd->writeVars();
@@ -1573,6 +1994,8 @@ void MultilevelCoupling::solveTransient_p()
         mesh->output->write(outputDir,"Solve_Time",duration);
       }
       mesh->advanceOneTimeStep();
+      if (checkpointInterval > 0 and (mesh->state-1)%checkpointInterval == 0)
+        writeCheckpoint(checkpointFile);
     }  
     else 
     {
@@ -1581,11 +2004,12 @@ void MultilevelCoupling::solveTransient_p()
       auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
       duration = elapsed.count()*1e-9;
       totalDuration = totalDuration + duration; 
-      cout << "Solution aborted after " << duration << " seconds." << endl;      
+      mesh->logger->warning("Multilevel") << "Solution aborted after " \
+        << duration << " seconds." << endl;
       mesh->output->write(outputDir,"Solve_Time",duration);
 
-      cout << "Solve not converged." << endl;
-      cout << "Transient aborted." << endl;
+      mesh->logger->warning("Multilevel") << "Solve not converged." << endl \
+        << "Transient aborted." << endl;
       break;
     }
   } 
@@ -1593,11 +2017,14 @@ void MultilevelCoupling::solveTransient_p()
   auto outerEnd = chrono::high_resolution_clock::now();
   auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(outerEnd - outerBegin);
   duration = elapsed.count()*1e-9;
-  cout << "Outer solve time: " << duration << " seconds." << endl;      
+  mesh->logger->info("Multilevel") << "Outer solve time: " << duration \
+    << " seconds." << endl;
 
   // Report total solve time
-  cout << "Total solve time: " << totalDuration << " seconds." << endl;      
+  mesh->logger->info("Multilevel") << "Total solve time: " << totalDuration \
+    << " seconds." << endl;
   mesh->output->write(outputDir,"Solve_Time",duration,true);
+  mesh->logger->flush();
 
 };
 //==============================================================================
@@ -1609,21 +2036,29 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
 {
 
   Eigen::VectorXd xCurrentIter, xLastMGHOTIter, xLastMGLOQDIter,xLastELOTIter,\
-    residualVector;
+    residualVector, xStepStart;
   vector<double> lastResidualELOT, lastResidualMGLOQD, residualMGHOT = {1,1,1},\
     residualMGLOQD = {1,1,1}, residualELOT = {1,1,1};
-  bool eddingtonConverged;
+  bool eddingtonConverged, predicted;
   bool convergedMGHOT=false, convergedMGLOQD=false, convergedELOT=false;
   int itersMGHOT = 0, itersMGLOQD = 0, itersELOT = 0;
   vector<int> iters;
   vector<double> tempResMGHOT,tempResMGLOQD,tempResELOT,tempResiduals;
   vector<double> fluxResMGHOT,fluxResMGLOQD,fluxResELOT,fluxResiduals;
+  vector<double> targets;
+  double mghotSeconds = 0.0,mgloqdSeconds = 0.0,eddingtonResidual = NAN;
  
   // Timing variables 
   double duration,totalDuration = 0.0,elotDuration = 0,\
     mgloqdDuration = 0, mghotDuration = 0;
   clock_t startTime;
 
+  // Start from solutions extrapolated from previous time steps. The first
+  // MGHOT residual is still measured from the last converged state.
+  petscVecToEigenVec(&(mpqd->x_p),&xStepStart);
+  predicted = predictInitialGuess_p();
+  mghotPolicy->groupsSolved.clear();
+
   while (not convergedMGHOT){ 
 
     ////////////////////
@@ -1633,30 +2068,59 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
     // Only solve the MGHOT after we've got an estimate for the ELOT solution
     if (itersMGHOT != 0 and not p1Approx)
     {
+      // Decide which groups need a new transport solution. If none do,
+      // the lagged Eddington factors and BCs would reproduce the current 
+      // LO solution, so the step is done.
+      if (not mghotPolicy->decide(residualMGHOT[0],itersMGHOT == 1))
+      {
+        mesh->logger->info("MGHOT") \
+          << "MGHOT solve skipped, reusing lagged Eddington factors." << endl;
+        trace->record(ConvergenceTrace::levelMGHOT,itersMGHOT,residualMGHOT,\
+          {eps(mpqd->epsMPQD),eps(mpqd->epsMPQD)},NAN,0.0,\
+          ConvergenceTrace::skipped);
+        break;
+      }
+
       // Solve MGHOT problem
-      cout << "MGHOT solve...";
+      mesh->logger->info("MGHOT") << "MGHOT solve...";
       auto begin = chrono::high_resolution_clock::now();
-      solveMGHOT();
+      if (pipelineMGHOT)
+        eddingtonConverged = solveMGHOTPipelined();
+      else
+        solveMGHOT();
       auto end = chrono::high_resolution_clock::now();
       auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
       duration = elapsed.count()*1e-9;
       mghotDuration = mghotDuration + duration;
-      cout << " done. ("<< duration << " seconds)" << endl;
+      mghotSeconds = duration;
+      mesh->logger->info("MGHOT") << " done. (" << duration << " seconds)" \
+        << endl;
       iters.push_back(3);
 
-      // Calculate Eddington factors for MGQD problem
-      cout << "Calculating MGLOQD Eddington factors...";
-      eddingtonConverged = MGTToMGQD->calcEddingtonFactors();
-      cout << " done."<< endl;
-
-      // Calculate BCs for MGQD problem 
-      cout << "Calculating MGLOQD boundary conditions...";
-      MGTToMGQD->calcBCs();
-      cout << " done."<< endl;
+      // The pipelined solve has already coupled each group to the MGLOQD
+      if (not pipelineMGHOT)
+      {
+        // Calculate Eddington factors for MGQD problem
+        mesh->logger->info("MGLOQD") \
+          << "Calculating MGLOQD Eddington factors...";
+        eddingtonConverged = MGTToMGQD->calcEddingtonFactors();
+        mesh->logger->info("MGLOQD") << " done." << endl;
+
+        // Calculate BCs for MGQD problem 
+        mesh->logger->info("MGLOQD") \
+          << "Calculating MGLOQD boundary conditions...";
+        MGTToMGQD->calcBCs();
+        mesh->logger->info("MGLOQD") << " done." << endl;
+      }
+      eddingtonResidual = MGTToMGQD->eddingtonResiduals.maxCoeff();
+      mghotPolicy->recordEddingtonDrift(MGTToMGQD->eddingtonResiduals);
     }
 
     // Store last iterate of ELOT solution used in MGHOT level
-    petscVecToEigenVec(&(mpqd->x_p),&xLastMGHOTIter);
+    if (itersMGHOT == 0)
+      xLastMGHOTIter = xStepStart;
+    else
+      petscVecToEigenVec(&(mpqd->x_p),&xLastMGHOTIter);
     
     while (not convergedMGLOQD){
 
@@ -1665,16 +2129,16 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
       /////////////////////
 
       // Solve MGLOQD problem
-      cout << "    ";
-      cout << "MGLOQD solve..." << endl;
+      mesh->logger->info("MGLOQD") << "    MGLOQD solve..." << endl;
       auto begin = chrono::high_resolution_clock::now();
       solveMGLOQD_p();
       auto end = chrono::high_resolution_clock::now();
       auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
       duration = elapsed.count()*1e-9;
       mgloqdDuration = mgloqdDuration + duration;
-      cout << "    ";
-      cout << "MGLOQD solve done. ("<< duration << " seconds)" << endl;
+      mgloqdSeconds = duration;
+      mesh->logger->info("MGLOQD") << "    MGLOQD solve done. (" << duration \
+        << " seconds)" << endl;
       iters.push_back(2);
 
       // Get group fluxes to use in group collapse
@@ -1690,28 +2154,26 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
         ///////////////////
 
         // Calculate collapsed nuclear data
-        cout << "        ";
-        cout << "Collapsing MGLOQD data for ELOT solve...";
+        mesh->logger->info("ELOT") \
+          << "        Collapsing MGLOQD data for ELOT solve...";
         MGQDToMPQD->collapseNuclearData();
-        cout << " done."<< endl;
+        mesh->logger->info("ELOT") << " done." << endl;
         
         // Store last iterate of ELOT solution used in ELOT level
-        cout << "        ";
-        cout << "Storing last solution...";
+        mesh->logger->info("ELOT") << "        Storing last solution...";
         petscVecToEigenVec(&(mpqd->x_p),&xLastELOTIter);
-        cout << " done."<< endl;
+        mesh->logger->info("ELOT") << " done." << endl;
       
         // Solve ELOT problem
-        cout << "        ";
-        cout << "ELOT solve..." << endl;
+        mesh->logger->info("ELOT") << "        ELOT solve..." << endl;
         auto begin = chrono::high_resolution_clock::now();
         solveELOT_p();
         auto end = chrono::high_resolution_clock::now();
         auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
         duration = elapsed.count()*1e-9;
         elotDuration = elotDuration + duration;
-        cout << "        ";
-        cout << "ELOT solve done. ("<< duration << " seconds)" << endl;
+        mesh->logger->info("ELOT") << "        ELOT solve done. (" << duration \
+          << " seconds)" << endl;
         iters.push_back(1);
 
         // Store newest iterate 
@@ -1721,9 +2183,8 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
 
         // Calculate and print ELOT residual  
         residualELOT = MGQDToMPQD->calcResidual(xCurrentIter,xLastELOTIter);
-        cout << "        ";
-        cout << "ELOT Residual: " << residualELOT[0]; 
-        cout << ", " << residualELOT[1] << endl;
+        mesh->logger->iteration("ELOT") << "        ELOT Residual: " \
+          << residualELOT[0] << ", " << residualELOT[1] << endl;
 
         // Update iterate counters, store residuals
         itersELOT++;
@@ -1733,11 +2194,18 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
         // Calculate collapsed nuclear data at new temperature
         mats->updateTemperature(mpqd->heat->returnCurrentTemp());
 
+        // Thresholds this iterate is checked against
+        targets = {eps(residualMGLOQD[0],relaxTolELOT),\
+          eps(residualMGLOQD[1],relaxTolELOT)};
+
         // Check if residuals are too big or if the residuals have increased
         // from the last MGLOQD residual 
         if (residualELOT[0]/lastResidualELOT[0] > resetThreshold and\
             residualELOT[1]/lastResidualELOT[1] > resetThreshold) 
         {
+          trace->record(ConvergenceTrace::levelELOT,itersELOT,residualELOT,\
+            targets,NAN,duration,ConvergenceTrace::reset);
+
           // Jump back to MGLOQD level
           break;
         }
@@ -1749,6 +2217,10 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
           convergedELOT = true;
         }
 
+        trace->record(ConvergenceTrace::levelELOT,itersELOT,residualELOT,\
+          targets,NAN,duration,convergedELOT ? ConvergenceTrace::converged \
+          : ConvergenceTrace::iterate);
+
       } // ELOT
     
       // Reset convergence indicator
@@ -1762,11 +2234,8 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
  
       // Calculate and print MGLOQD residual 
       residualMGLOQD = MGQDToMPQD->calcResidual(xCurrentIter,xLastMGLOQDIter);
-      cout << endl;
-      cout << "    ";
-      cout << "MGLOQD Residual: " << residualMGLOQD[0];
-      cout << ", " << residualMGLOQD[1] << endl;
-      cout << endl;
+      mesh->logger->iteration("MGLOQD") << endl << "    MGLOQD Residual: " \
+        << residualMGLOQD[0] << ", " << residualMGLOQD[1] << endl << endl;
         
       // Update iterate counters, store residuals
       itersMGLOQD++;
@@ -1781,11 +2250,18 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
           tempResELOT.begin(),tempResELOT.end());
       tempResELOT.clear();
 
+      // Thresholds this iterate is checked against
+      targets = {eps(residualMGHOT[0],relaxTolMGLOQD),\
+        eps(residualMGHOT[1],relaxTolMGLOQD)};
+
       // Check if residuals are too big or if the residuals have increased
       // from the last MGLOQD residual 
       if (residualMGLOQD[0]/lastResidualMGLOQD[0] > resetThreshold or\
           residualMGLOQD[1]/lastResidualMGLOQD[1] > resetThreshold) 
       {
+        trace->record(ConvergenceTrace::levelMGLOQD,itersMGLOQD,residualMGLOQD,\
+          targets,NAN,mgloqdSeconds,ConvergenceTrace::reset);
+
         // Jump back to MGHOT level
         break;
       }
@@ -1797,6 +2273,10 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
         convergedMGLOQD = true;
       }
 
+      trace->record(ConvergenceTrace::levelMGLOQD,itersMGLOQD,residualMGLOQD,\
+        targets,NAN,mgloqdSeconds,convergedMGLOQD ? \
+        ConvergenceTrace::converged : ConvergenceTrace::iterate);
+
     } // MGLOQD
     
     // Reset convergence indicator
@@ -1804,9 +2284,8 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
      
     // Calculate and print MGHOT residual 
     residualMGHOT = MGQDToMPQD->calcResidual(xCurrentIter,xLastMGHOTIter);
-    cout << "MGHOT Residual: " << residualMGHOT[0];
-    cout << ", " << residualMGHOT[1] << endl;
-    cout << endl;
+    mesh->logger->iteration("MGHOT") << "MGHOT Residual: " << residualMGHOT[0] \
+      << ", " << residualMGHOT[1] << endl << endl;
       
     // Update iterate counters, store residuals
     itersMGHOT++;
@@ -1830,24 +2309,35 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
         tempResMGHOT.end());
     tempResMGHOT.clear();
       
-    // Check converge criteria 
-    if (eps(mpqd->epsMPQD) > residualMGHOT[0] and\
-        eps(mpqd->epsMPQD) > residualMGHOT[1]) 
-    {
-      convergedMGHOT = true;
-    }
+    targets = {eps(mpqd->epsMPQD),eps(mpqd->epsMPQD)};
+
+    // Store last iterate of ELOT solution used in MGHOT level
+    if (itersMGHOT == 0)
+      xLastMGHOTIter = xStepStart;
+    else
+      petscVecToEigenVec(&(mpqd->x_p),&xLastMGHOTIter);
+
+    // The first pass solves only the LO levels
+    trace->record(ConvergenceTrace::levelMGHOT,itersMGHOT-1,residualMGHOT,\
+      targets,eddingtonResidual,mghotSeconds,convergedMGHOT ? \
+      ConvergenceTrace::converged : ConvergenceTrace::iterate);
+    mghotSeconds = 0.0;
+    eddingtonResidual = NAN;
 
   } //MGHOT
     
-  cout << endl;
+  mesh->logger->info("Multilevel") << endl;
+
+  trace->flush();
 
   // Correct MGHOT iteration count. (process starts with MGLOQD solve)
   itersMGHOT = itersMGHOT - 1;
+  lastStepItersMGHOT = itersMGHOT;
    
   // Write iteration countrs to console 
-  cout << "MGHOT iterations: " << itersMGHOT << endl;
-  cout << "MGLOQD iterations: " << itersMGLOQD << endl;
-  cout << "ELOT iterations: " << itersELOT << endl;
+  mesh->logger->info("Multilevel") << "MGHOT iterations: " << itersMGHOT \
+    << endl << "MGLOQD iterations: " << itersMGLOQD << endl \
+    << "ELOT iterations: " << itersELOT << endl;
  
   // Output iteration counts 
   if (outputVars)
@@ -1856,6 +2346,7 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
     mesh->output->write(outputDir,"MGLOQD_iters",itersMGLOQD);
     mesh->output->write(outputDir,"ELOT_iters",itersELOT);
     mesh->output->write(outputDir,"iterates",iters);
+    mghotPolicy->writeVars(outputDir);
     mesh->output->write(outputDir,"flux_residuals",fluxResiduals);
     mesh->output->write(outputDir,"temp_residuals",tempResiduals);
     mesh->output->write(outputDir,"MGHOT_Time",mghotDuration);
@@ -1873,23 +2364,37 @@ bool MultilevelCoupling::solveOneStepResidualBalance_p(bool outputVars)
 ///
 void MultilevelCoupling::solveMGLOQD_p()
 {
+
+  ScopedTimer timer(mesh->profiler,"MGLOQD");
+  trace->beginSolve();
   
   PetscErrorCode ierr;
 
   // Build flux system
-  mgqd->buildLinearSystem_p();
+  {
+    ScopedTimer timer(mesh->profiler,"assemble");
+    mgqd->buildLinearSystem_p();
+  }
 
   // Solve flux system
-  mgqd->solveLinearSystem_p();
+  {
+    ScopedTimer timer(mesh->profiler,"solve");
+    mgqd->solveLinearSystem_p();
+  }
   
   // Build neutron current system
-  mgqd->buildBackCalcSystem_p();
+  {
+    ScopedTimer timer(mesh->profiler,"backCalc");
+    mgqd->buildBackCalcSystem_p();
   
-  //cout << "MGLOQD b_p" << endl;
-  //VecView(mgqd->QDSolve->b_p,PETSC_VIEWER_STDOUT_WORLD);
+    //cout << "MGLOQD b_p" << endl;
+    //VecView(mgqd->QDSolve->b_p,PETSC_VIEWER_STDOUT_WORLD);
+
+    // Solve neutron current system
+    mgqd->backCalculateCurrent_p();
+  }
 
-  // Solve neutron current system
-  mgqd->backCalculateCurrent_p();
+  trace->endSolve(ConvergenceTrace::levelMGLOQD);
 
 };
 //==============================================================================
@@ -1900,17 +2405,639 @@ void MultilevelCoupling::solveMGLOQD_p()
 void MultilevelCoupling::solveELOT_p()
 {
 
+  ScopedTimer timer(mesh->profiler,"ELOT");
+  trace->beginSolve();
+
   // Build ELOT system
-  mpqd->buildLinearSystem_p();
+  {
+    ScopedTimer timer(mesh->profiler,"assemble");
+    mpqd->buildLinearSystem_p();
+  }
 
-  mpqd->solve_p();
+  {
+    ScopedTimer timer(mesh->profiler,"solve");
+    mpqd->solve_p();
+  }
   
   //cout << "ELOT x_p" << endl;
   //VecView(mpqd->x_p,PETSC_VIEWER_STDOUT_WORLD);
 
+  trace->endSolve(ConvergenceTrace::levelELOT);
+
+};
+//==============================================================================
+
+
+//==============================================================================
+/// PETSc version of predictInitialGuess 
+///
+/// @return whether a predictor replaced the solution vectors
+bool MultilevelCoupling::predictInitialGuess_p()
+{
+
+  double time = mesh->ts[mesh->state];
+  Eigen::VectorXd predictor;
+
+  if (not elotHistory->ready())
+    return false;
+
+  predictor = elotHistory->extrapolate(time);
+  eigenVecToPETScVec(&predictor,&(mpqd->x_p));
+
+  if (mgloqdHistory->ready())
+  {
+    predictor = mgloqdHistory->extrapolate(time);
+    eigenVecToPETScVec(&predictor,&(mgqd->QDSolve->x_p));
+  }
+
+  // Use predicted temperatures to evaluate the first set of cross sections
+  if (predictTemperature)
+    mats->updateTemperature(mpqd->heat->returnCurrentTemp());
+
+  return true;
+
 };
 //==============================================================================
 
+//==============================================================================
+/// PETSc version of storeSolutionHistory 
+///
+/// @param [in] reset discard previously stored solutions first 
+void MultilevelCoupling::storeSolutionHistory_p(bool reset)
+{
+
+  double time = mesh->ts[mesh->state];
+  Eigen::VectorXd state;
+
+  if (extrapolationOrder == 0)
+    return;
+
+  if (reset)
+  {
+    elotHistory->clear();
+    mgloqdHistory->clear();
+  }
+
+  petscVecToEigenVec(&(mpqd->x_p),&state);
+  elotHistory->push(time,state);
+  petscVecToEigenVec(&(mgqd->QDSolve->x_p),&state);
+  mgloqdHistory->push(time,state);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load all state needed to continue a transient. The same list of
+/// fields is used in both directions.
+///
+/// @param [in] archive checkpoint being written or read
+void MultilevelCoupling::transferState(Checkpoint * archive)
+{
+
+  string prefix;
+  arma::cube aFlux,aHalfFlux;
+  SingleGroupDNP * dnp;
+  GreyGroupQD * ggqd = mpqd->ggqd;
+  HeatTransfer * heat = mpqd->heat;
+  MultiGroupDNP * mgdnp = mpqd->mgdnp;
+  CollapsedCrossSections * xs = mats->oneGroupXS;
+
+  // Time step
+  archive->field("mesh/state",mesh->state);
+  archive->field("mesh/dt",mesh->dt);
+
+  // Transport
+  for (int iGroup = 0; iGroup < mgt->SGTs.size(); iGroup++)
+  {
+    prefix = "MGT/" + to_string(iGroup) + "/";
+
+    // Each rank only sweeps part of the angular flux under decomposition, 
+    // so a checkpoint stores the copy assembled from all ranks
+    aFlux = mgt->SGTs[iGroup]->aFlux;
+    aHalfFlux = mgt->SGTs[iGroup]->aHalfFlux;
+    if (archive->saving)
+      mgt->decomposition->gather(iGroup,&aFlux,&aHalfFlux);
+    archive->field(prefix + "aFlux",aFlux);
+    archive->field(prefix + "aHalfFlux",aHalfFlux);
+    if (not archive->saving)
+    {
+      mgt->SGTs[iGroup]->aFlux = aFlux;
+      mgt->SGTs[iGroup]->aHalfFlux = aHalfFlux;
+    }
+
+    archive->field(prefix + "sFlux",mgt->SGTs[iGroup]->sFlux);
+    archive->field(prefix + "sFluxPrev",mgt->SGTs[iGroup]->sFluxPrev);
+    archive->field(prefix + "alpha",mgt->SGTs[iGroup]->alpha);
+    archive->field(prefix + "q",mgt->SGTs[iGroup]->q);
+    archive->field(prefix + "fissionSource",mgt->SGTs[iGroup]->fissionSource);
+    archive->field(prefix + "scatterSource",mgt->SGTs[iGroup]->scatterSource);
+  }
+
+  // Multigroup quasidiffusion
+  for (int iGroup = 0; iGroup < mgqd->SGQDs.size(); iGroup++)
+  {
+    SingleGroupQD * sgqd = mgqd->SGQDs[iGroup].get();
+    prefix = "MGQD/" + to_string(iGroup) + "/";
+    archive->field(prefix + "sFlux",sgqd->sFlux);
+    archive->field(prefix + "sFluxPrev",sgqd->sFluxPrev);
+    archive->field(prefix + "sFluxR",sgqd->sFluxR);
+    archive->field(prefix + "sFluxRPrev",sgqd->sFluxRPrev);
+    archive->field(prefix + "sFluxZ",sgqd->sFluxZ);
+    archive->field(prefix + "sFluxZPrev",sgqd->sFluxZPrev);
+    archive->field(prefix + "currentR",sgqd->currentR);
+    archive->field(prefix + "currentRPrev",sgqd->currentRPrev);
+    archive->field(prefix + "currentZ",sgqd->currentZ);
+    archive->field(prefix + "currentZPrev",sgqd->currentZPrev);
+    archive->field(prefix + "q",sgqd->q);
+    archive->field(prefix + "fissionSource",sgqd->fissionSource);
+    archive->field(prefix + "scatterSource",sgqd->scatterSource);
+    archive->field(prefix + "Err",sgqd->Err);
+    archive->field(prefix + "ErrPrev",sgqd->ErrPrev);
+    archive->field(prefix + "Ezz",sgqd->Ezz);
+    archive->field(prefix + "EzzPrev",sgqd->EzzPrev);
+    archive->field(prefix + "Erz",sgqd->Erz);
+    archive->field(prefix + "ErzPrev",sgqd->ErzPrev);
+    archive->field(prefix + "ErrAxial",sgqd->ErrAxial);
+    archive->field(prefix + "EzzAxial",sgqd->EzzAxial);
+    archive->field(prefix + "ErzAxial",sgqd->ErzAxial);
+    archive->field(prefix + "ErrRadial",sgqd->ErrRadial);
+    archive->field(prefix + "EzzRadial",sgqd->EzzRadial);
+    archive->field(prefix + "ErzRadial",sgqd->ErzRadial);
+    archive->field(prefix + "G",sgqd->G);
+    archive->field(prefix + "GRadial",sgqd->GRadial);
+    archive->field(prefix + "g0",sgqd->g0);
+    archive->field(prefix + "g1",sgqd->g1);
+    archive->field(prefix + "wFluxBC",sgqd->wFluxBC);
+    archive->field(prefix + "eFluxBC",sgqd->eFluxBC);
+    archive->field(prefix + "nFluxBC",sgqd->nFluxBC);
+    archive->field(prefix + "sFluxBC",sgqd->sFluxBC);
+    archive->field(prefix + "wCurrentRBC",sgqd->wCurrentRBC);
+    archive->field(prefix + "eCurrentRBC",sgqd->eCurrentRBC);
+    archive->field(prefix + "nCurrentZBC",sgqd->nCurrentZBC);
+    archive->field(prefix + "sCurrentZBC",sgqd->sCurrentZBC);
+    archive->field(prefix + "eInwardCurrentBC",sgqd->eInwardCurrentBC);
+    archive->field(prefix + "nInwardCurrentBC",sgqd->nInwardCurrentBC);
+    archive->field(prefix + "sInwardCurrentBC",sgqd->sInwardCurrentBC);
+    archive->field(prefix + "eInwardFluxBC",sgqd->eInwardFluxBC);
+    archive->field(prefix + "nInwardFluxBC",sgqd->nInwardFluxBC);
+    archive->field(prefix + "sInwardFluxBC",sgqd->sInwardFluxBC);
+    archive->field(prefix + "eOutwardCurrToFluxRatioBC",\
+        sgqd->eOutwardCurrToFluxRatioBC);
+    archive->field(prefix + "nOutwardCurrToFluxRatioBC",\
+        sgqd->nOutwardCurrToFluxRatioBC);
+    archive->field(prefix + "sOutwardCurrToFluxRatioBC",\
+        sgqd->sOutwardCurrToFluxRatioBC);
+    archive->field(prefix + "eAbsCurrentBC",sgqd->eAbsCurrentBC);
+    archive->field(prefix + "nAbsCurrentBC",sgqd->nAbsCurrentBC);
+    archive->field(prefix + "sAbsCurrentBC",sgqd->sAbsCurrentBC);
+  }
+  archive->field("MGQD/x",mgqd->QDSolve->x);
+  archive->field("MGQD/xPast",mgqd->QDSolve->xPast);
+  archive->field("MGQD/currPast",mgqd->QDSolve->currPast);
+
+  // Multiphysics quasidiffusion
+  archive->field("MPQD/x",mpqd->x);
+  archive->field("MPQD/xPast",mpqd->xPast);
+
+  // Grey group quasidiffusion
+  archive->field("GGQD/sFlux",ggqd->sFlux);
+  archive->field("GGQD/sFluxPrev",ggqd->sFluxPrev);
+  archive->field("GGQD/sFluxR",ggqd->sFluxR);
+  archive->field("GGQD/sFluxZ",ggqd->sFluxZ);
+  archive->field("GGQD/currentR",ggqd->currentR);
+  archive->field("GGQD/currentZ",ggqd->currentZ);
+  archive->field("GGQD/q",ggqd->q);
+  archive->field("GGQD/Err",ggqd->Err);
+  archive->field("GGQD/ErrPrev",ggqd->ErrPrev);
+  archive->field("GGQD/Ezz",ggqd->Ezz);
+  archive->field("GGQD/EzzPrev",ggqd->EzzPrev);
+  archive->field("GGQD/Erz",ggqd->Erz);
+  archive->field("GGQD/ErzPrev",ggqd->ErzPrev);
+  archive->field("GGQD/ErrAxial",ggqd->ErrAxial);
+  archive->field("GGQD/EzzAxial",ggqd->EzzAxial);
+  archive->field("GGQD/ErzAxial",ggqd->ErzAxial);
+  archive->field("GGQD/ErrRadial",ggqd->ErrRadial);
+  archive->field("GGQD/EzzRadial",ggqd->EzzRadial);
+  archive->field("GGQD/ErzRadial",ggqd->ErzRadial);
+  archive->field("GGQD/GL",ggqd->GL);
+  archive->field("GGQD/GR",ggqd->GR);
+  archive->field("GGQD/g0",ggqd->g0);
+  archive->field("GGQD/g1",ggqd->g1);
+  archive->field("GGQD/wFluxBC",ggqd->wFluxBC);
+  archive->field("GGQD/eFluxBC",ggqd->eFluxBC);
+  archive->field("GGQD/nFluxBC",ggqd->nFluxBC);
+  archive->field("GGQD/sFluxBC",ggqd->sFluxBC);
+  archive->field("GGQD/wCurrentRBC",ggqd->wCurrentRBC);
+  archive->field("GGQD/eCurrentRBC",ggqd->eCurrentRBC);
+  archive->field("GGQD/nCurrentZBC",ggqd->nCurrentZBC);
+  archive->field("GGQD/sCurrentZBC",ggqd->sCurrentZBC);
+  archive->field("GGQD/eInwardCurrentBC",ggqd->eInwardCurrentBC);
+  archive->field("GGQD/nInwardCurrentBC",ggqd->nInwardCurrentBC);
+  archive->field("GGQD/sInwardCurrentBC",ggqd->sInwardCurrentBC);
+  archive->field("GGQD/eInwardFluxBC",ggqd->eInwardFluxBC);
+  archive->field("GGQD/nInwardFluxBC",ggqd->nInwardFluxBC);
+  archive->field("GGQD/sInwardFluxBC",ggqd->sInwardFluxBC);
+  archive->field("GGQD/eOutwardCurrToFluxRatioBC",\
+      ggqd->eOutwardCurrToFluxRatioBC);
+  archive->field("GGQD/nOutwardCurrToFluxRatioBC",\
+      ggqd->nOutwardCurrToFluxRatioBC);
+  archive->field("GGQD/sOutwardCurrToFluxRatioBC",\
+      ggqd->sOutwardCurrToFluxRatioBC);
+  archive->field("GGQD/eOutwardCurrToFluxRatioInwardWeightedBC",\
+      ggqd->eOutwardCurrToFluxRatioInwardWeightedBC);
+  archive->field("GGQD/nOutwardCurrToFluxRatioInwardWeightedBC",\
+      ggqd->nOutwardCurrToFluxRatioInwardWeightedBC);
+  archive->field("GGQD/sOutwardCurrToFluxRatioInwardWeightedBC",\
+      ggqd->sOutwardCurrToFluxRatioInwardWeightedBC);
+  archive->field("GGQD/eAbsCurrentBC",ggqd->eAbsCurrentBC);
+  archive->field("GGQD/nAbsCurrentBC",ggqd->nAbsCurrentBC);
+  archive->field("GGQD/sAbsCurrentBC",ggqd->sAbsCurrentBC);
+
+  // Heat transfer
+  archive->field("heat/temp",heat->temp);
+  archive->field("heat/inletTemp",heat->inletTemp);
+  archive->field("heat/outletTemp",heat->outletTemp);
+  archive->field("heat/advRate",heat->advRate);
+  archive->field("heat/advUpdateState",heat->advUpdateState);
+
+  // Delayed neutron precursors
+  archive->field("DNP/recircx",mgdnp->recircx);
+  archive->field("DNP/dnpSource",mgdnp->dnpSource);
+  for (int iDNP = 0; iDNP < mgdnp->DNPs.size(); iDNP++)
+  {
+    dnp = mgdnp->DNPs[iDNP].get();
+    prefix = "DNP/" + to_string(iDNP) + "/";
+    archive->field(prefix + "dnpConc",dnp->dnpConc);
+    archive->field(prefix + "recircConc",dnp->recircConc);
+    archive->field(prefix + "inletConc",dnp->inletConc);
+    archive->field(prefix + "recircInletConc",dnp->recircInletConc);
+    archive->field(prefix + "outletConc",dnp->outletConc);
+    archive->field(prefix + "recircOutletConc",dnp->recircOutletConc);
+    archive->field(prefix + "coreAdvRate",dnp->coreAdvRate);
+    archive->field(prefix + "recircAdvRate",dnp->recircAdvRate);
+    archive->field(prefix + "advUpdateState",dnp->advUpdateState);
+    archive->field(prefix + "outletHistory",dnp->outletHistory);
+    archive->field(prefix + "historyTimes",dnp->historyTimes);
+    archive->field(prefix + "historyStartTime",dnp->historyStartTime);
+    archive->field(prefix + "historyHead",dnp->historyHead);
+    archive->field(prefix + "historyCount",dnp->historyCount);
+    archive->field(prefix + "recircConcInit",dnp->recircConcInit);
+    archive->field(prefix + "recircTransitTimes",dnp->recircTransitTimes);
+    archive->field(prefix + "recircTransitTimesInit",\
+        dnp->recircTransitTimesInit);
+  }
+
+  // Material temperatures and collapsed cross sections
+  archive->field("mats/temperature",mats->temperature);
+  archive->field("1GXS/sigT",xs->sigT);
+  archive->field("1GXS/sigS",xs->sigS);
+  archive->field("1GXS/sigF",xs->sigF);
+  archive->field("1GXS/rSigTR",xs->rSigTR);
+  archive->field("1GXS/zSigTR",xs->zSigTR);
+  archive->field("1GXS/neutV",xs->neutV);
+  archive->field("1GXS/neutVPast",xs->neutVPast);
+  archive->field("1GXS/rNeutV",xs->rNeutV);
+  archive->field("1GXS/rNeutVPast",xs->rNeutVPast);
+  archive->field("1GXS/zNeutV",xs->zNeutV);
+  archive->field("1GXS/zNeutVPast",xs->zNeutVPast);
+  archive->field("1GXS/qdFluxCoeff",xs->qdFluxCoeff);
+  archive->field("1GXS/Ezz",xs->Ezz);
+  archive->field("1GXS/Err",xs->Err);
+  archive->field("1GXS/Erz",xs->Erz);
+  archive->field("1GXS/rZeta1",xs->rZeta1);
+  archive->field("1GXS/rZeta2",xs->rZeta2);
+  archive->field("1GXS/rZeta",xs->rZeta);
+  archive->field("1GXS/zZeta1",xs->zZeta1);
+  archive->field("1GXS/zZeta2",xs->zZeta2);
+  archive->field("1GXS/zZeta",xs->zZeta);
+  archive->field("1GXS/keff",xs->keff);
+  archive->field("1GXS/kold",xs->kold);
+  archive->field("1GXS/groupDNPFluxCoeff",xs->groupDNPFluxCoeff);
+  archive->field("1GXS/groupSigS",xs->groupSigS);
+  archive->field("1GXS/groupUpscatterCoeff",xs->groupUpscatterCoeff);
+
+  // Acceleration state
+  transferHistory(archive,"history/ELOT",elotHistory);
+  transferHistory(archive,"history/MGLOQD",mgloqdHistory);
+  archive->field("MGHOT/lastStepResidual",mghotPolicy->lastStepResidual);
+  archive->field("MGHOT/passesSinceSolve",mghotPolicy->passesSinceSolve);
+  archive->field("MGHOT/lastSolveStep",mghotPolicy->lastSolveStep);
+  archive->field("MGHOT/driftRate",mghotPolicy->driftRate);
+  archive->field("MGHOT/lastDriftRate",mghotPolicy->lastDriftRate);
+  archive->field("MGHOT/passDriftRate",mghotPolicy->passDriftRate);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Save or load the states stored in a solution history
+///
+/// @param [in] archive checkpoint being written or read
+/// @param [in] name label of the history in the checkpoint 
+/// @param [in] history solution history to save or load
+void MultilevelCoupling::transferHistory(Checkpoint * archive,string name,\
+    SolutionHistory * history)
+{
+
+  Eigen::VectorXd times;
+  vector<Eigen::MatrixXd> states;
+
+  if (archive->saving)
+  {
+    times.setZero(history->times.size());
+    for (int iState = 0; iState < history->times.size(); iState++)
+    {
+      times(iState) = history->times[iState];
+      states.push_back(history->states[iState]);
+    }
+  }
+
+  archive->field(name + "/times",times);
+  archive->field(name + "/states",states);
+
+  if (not archive->saving)
+  {
+    history->clear();
+    for (int iState = 0; iState < times.size(); iState++)
+      history->push(times(iState),states[iState]);
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write the state at the end of the last converged time step 
+///
+/// @param [in] fileName path of checkpoint file
+/// @return whether the checkpoint was written
+bool MultilevelCoupling::writeCheckpoint(string fileName)
+{
+
+  Checkpoint archive(true,mesh->logger);
+  int rank = 0,initialized = 0,written = 1;
+
+  // Gather distributed solutions into their Eigen copies on every rank
+  if (mesh->petsc)
+  {
+    petscVecToEigenVec(&(mpqd->x_p),&(mpqd->x));
+    petscVecToEigenVec(&(mpqd->xPast_p),&(mpqd->xPast));
+    petscVecToEigenVec(&(mgqd->QDSolve->x_p),&(mgqd->QDSolve->x));
+    petscVecToEigenVec(&(mgqd->QDSolve->xPast_p),&(mgqd->QDSolve->xPast));
+    petscVecToEigenVec(&(mgqd->QDSolve->currPast_p),\
+        &(mgqd->QDSolve->currPast));
+  }
+
+  transferState(&archive);
+
+  mesh->logger->info("Multilevel") << "Writing checkpoint to " << fileName \
+    << endl;
+
+  // Every rank holds the gathered state, so only rank 0 writes the file and
+  // the others wait to learn whether it succeeded
+  MPI_Initialized(&initialized);
+  if (initialized)
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+
+  if (rank == 0)
+    written = archive.write(fileName);
+
+  if (initialized)
+    MPI_Bcast(&written,1,MPI_INT,0,PETSC_COMM_WORLD);
+
+  if (not written)
+  {
+    mesh->logger->warning("Multilevel") << "Checkpoint not written." << endl;
+    return false;
+  }
+
+  return true;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Restore the state written by writeCheckpoint
+///
+/// @param [in] fileName path of checkpoint file
+/// @return whether the checkpoint was read
+bool MultilevelCoupling::readCheckpoint(string fileName)
+{
+
+  Checkpoint archive(false,mesh->logger);
+
+  if (not archive.read(fileName))
+    return false;
+
+  transferState(&archive);
+
+  // A partial restart would silently mix restored and initial state
+  if (archive.nMissing > 0)
+  {
+    mesh->logger->warning("Multilevel") << archive.nMissing \
+      << " fields were not found in " << fileName << "; cannot restart." \
+      << endl;
+    return false;
+  }
+
+  // Distribute restored solutions and rebuild sequential copies of past 
+  // solutions, as is done after a converged time step
+  if (mesh->petsc)
+  {
+    eigenVecToPETScVec(&(mpqd->x),&(mpqd->x_p));
+    mpqd->xPast_p = mpqd->x_p;
+    scatterToAll_p(&(mpqd->xPast_p),&(mpqd->xPast_p_seq));
+
+    eigenVecToPETScVec(&(mgqd->QDSolve->x),&(mgqd->QDSolve->x_p));
+    mgqd->QDSolve->xPast_p = mgqd->QDSolve->x_p;
+    scatterToAll_p(&(mgqd->QDSolve->xPast_p),&(mgqd->QDSolve->xPast_p_seq));
+
+    eigenVecToPETScVec(&(mgqd->QDSolve->currPast),\
+        &(mgqd->QDSolve->currPast_p));
+    scatterToAll_p(&(mgqd->QDSolve->currPast_p),\
+        &(mgqd->QDSolve->currPast_p_seq));
+  }
+
+  return true;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Load a cached steady state whose inputs match this problem
+///
+/// @param [in] outputVars whether to write the loaded steady state 
+/// @return whether a cached steady state was loaded
+bool MultilevelCoupling::readSteadyStateCache(bool outputVars)
+{
+
+  string fileName,hash;
+
+  if (steadyStateCache.empty())
+    return false;
+
+  hash = calcSteadyStateHash();
+  if (hash.empty())
+    return false;
+
+  fileName = steadyStateCache + "steady_state_" + hash + ".qmc";
+
+  if (not ifstream(fileName).good())
+  {
+    mesh->logger->info("Multilevel") << "No cached steady state in " \
+      << fileName << endl;
+    return false;
+  }
+
+  if (not readCheckpoint(fileName))
+    return false;
+
+  mesh->logger->info("Multilevel") << "Loaded cached steady state from " \
+    << fileName << endl << endl;
+
+  if (outputVars)
+  {
+    mgqd->writeVars();
+    mpqd->writeVars(); 
+    mats->oneGroupXS->writeVars();
+  }
+
+  return true;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write the converged steady state to the steady state cache
+///
+void MultilevelCoupling::writeSteadyStateCache()
+{
+
+  string hash;
+
+  if (steadyStateCache.empty())
+    return;
+
+  hash = calcSteadyStateHash();
+  if (hash.empty())
+    return;
+
+  mesh->output->makePath(steadyStateCache);
+  writeCheckpoint(steadyStateCache + "steady_state_" + hash + ".qmc");
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Hash the inputs that determine the steady state. Parameters that only 
+/// control output, time stepping, or acceleration of the transient are left 
+/// out so that perturbation studies sharing a steady state hit the cache. 
+/// Nuclear data files referenced by the materials are hashed by content. If 
+/// one cannot be read the steady state is not cached.
+///
+/// @return hexadecimal 64-bit FNV-1a hash, or an empty string if a nuclear 
+///   data file could not be read
+string MultilevelCoupling::calcSteadyStateHash()
+{
+
+  YAML::Node hashedInput = YAML::Clone(*input);
+  YAML::Emitter emitter;
+  ifstream dataFile;
+  stringstream content,hash;
+  string fileName;
+  unsigned long long fnv = 14695981039346656037ULL;
+  vector<string> transientParams = {"solve type","outputDirectory",\
+    "outputEveryNSteps","outputFormat","asyncOutput","outputQueueSize",\
+    "verbose","nprocs","checkpointInterval","checkpointFile","restartFile",\
+    "steadyStateCache","extrapolationOrder","historyLength",\
+    "predictTemperature","adaptiveMGHOT","mghotDriftTol",\
+    "mghotResidualGrowth","mghotRefreshInterval","heatSubcycles",\
+    "heatMacroSteps","dnpSubcycles","dnpMacroSteps","advectionCourant",\
+    "diagnostics","diagnosticsEveryNSteps","profile","logLevel","logModules",\
+    "logIterationsEvery","logBufferSize","logConsole","logFile",\
+    "convergenceTrace","convergenceTraceFile","mghotDecomposition",\
+    "mghotRanks","sweepSubdomains","pipelineMGHOT","threadLimits",\
+    "threadAffinity","numaFirstTouch","cmfdCoarsenZ","cmfdCoarsenR",\
+    "cmfdCycleIterations","condenseMGLOQD","condenseELOT"};
+  vector<string> dataFileKeys = {"sigTFile","sigFFile","sigSFile","nuFile",\
+    "neutVFile"};
+
+  hashedInput["mesh"].remove("T");
+  for (int iParam = 0; iParam < transientParams.size(); iParam++)
+    hashedInput["parameters"].remove(transientParams[iParam]);
+
+  emitter << hashedInput;
+  content << emitter.c_str();
+
+  // Append contents of nuclear data files. Their paths are taken as given,
+  // relative to the working directory, as Materials reads them.
+  YAML::Node materials = hashedInput["materials"];
+  for (YAML::const_iterator it=materials.begin();it!=materials.end();++it)
+  {
+    for (int iKey = 0; iKey < dataFileKeys.size(); iKey++)
+    {
+      if (not it->second[dataFileKeys[iKey]])
+        continue;
+      fileName = it->second[dataFileKeys[iKey]].as<string>();
+      dataFile.open(fileName,ios::binary);
+      if (not dataFile.is_open())
+      {
+        mesh->logger->warning("Multilevel") << "Could not read " << fileName \
+          << ", steady state will not be cached." << endl;
+        return "";
+      }
+
+      // Copying an empty file would leave content in a failed state
+      content << fileName << endl;
+      if (dataFile.peek() != EOF)
+        content << dataFile.rdbuf();
+      dataFile.close();
+      dataFile.clear();
+
+      if (content.fail())
+      {
+        mesh->logger->warning("Multilevel") << "Could not read " << fileName \
+          << ", steady state will not be cached." << endl;
+        return "";
+      }
+    }
+  }
+
+  for (char c : content.str())
+  {
+    fnv ^= (unsigned char) c;
+    fnv *= 1099511628211ULL;
+  }
+
+  hash << hex << setw(16) << setfill('0') << fnv;
+
+  return hash.str();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Replace a sequential copy of a distributed PETSc vector
+///
+/// @param [in] source distributed vector
+/// @param [out] copy sequential copy held on every process
+int MultilevelCoupling::scatterToAll_p(Vec * source,Vec * copy)
+{
+
+  PetscErrorCode ierr;
+  VecScatter     ctx;
+
+  ierr = VecDestroy(copy);CHKERRQ(ierr);
+  ierr = VecScatterCreateToAll(*source,&ctx,copy);CHKERRQ(ierr);
+  ierr = VecScatterBegin(ctx,*source,*copy,INSERT_VALUES,SCATTER_FORWARD);\
+    CHKERRQ(ierr);
+  ierr = VecScatterEnd(ctx,*source,*copy,INSERT_VALUES,SCATTER_FORWARD);\
+    CHKERRQ(ierr);
+  ierr = VecScatterDestroy(&ctx);CHKERRQ(ierr);
+
+  return ierr;
+
+};
+//==============================================================================
 
 //==============================================================================
 /// Read in optional parameters that might be specified in the input 
@@ -1947,6 +3074,52 @@ void MultilevelCoupling::checkOptionalParameters()
   if ((*input)["parameters"]["iterativeMGLOQD"])
     iterativeMGLOQD=(*input)["parameters"]["iterativeMGLOQD"].as<bool>();
 
+  // Check for order of initial guess extrapolation between time steps
+  if ((*input)["parameters"]["extrapolationOrder"])
+    extrapolationOrder=(*input)["parameters"]["extrapolationOrder"].as<int>();
+
+  // Check for number of past solutions used in extrapolation 
+  if ((*input)["parameters"]["historyLength"])
+    historyLength=(*input)["parameters"]["historyLength"].as<int>();
+
+  // Check if extrapolated temperatures should set initial cross sections 
+  if ((*input)["parameters"]["predictTemperature"])
+    predictTemperature=(*input)["parameters"]["predictTemperature"].as<bool>();
+
+  // Check for number of time steps between checkpoints
+  if ((*input)["parameters"]["checkpointInterval"])
+    checkpointInterval=(*input)["parameters"]["checkpointInterval"].as<int>();
+
+  // Check for checkpoint file name 
+  if ((*input)["parameters"]["checkpointFile"])
+    checkpointFile=(*input)["parameters"]["checkpointFile"].as<string>();
+
+  // Check for directory of cached steady states 
+  if ((*input)["parameters"]["steadyStateCache"])
+  {
+    steadyStateCache=(*input)["parameters"]["steadyStateCache"].as<string>();
+    if (not steadyStateCache.empty() and steadyStateCache.back() != '/')
+      steadyStateCache += "/";
+  }
+
+  // Check for checkpoint to restart a transient from 
+  if ((*input)["parameters"]["restartFile"])
+    restartFile=(*input)["parameters"]["restartFile"].as<string>();
+
+  // Check if Eddington factors should be computed while sweeps continue
+  if ((*input)["parameters"]["pipelineMGHOT"])
+    pipelineMGHOT=(*input)["parameters"]["pipelineMGHOT"].as<bool>();
+
+  // Moments are summed over ranks one group after another, which the task
+  // graph would reorder
+  if (pipelineMGHOT and mgt->decomposition->mode != \
+    TransportDecomposition::none and mgt->decomposition->nRanks > 1)
+  {
+    mesh->logger->warning("MultilevelCoupling") << "pipelineMGHOT is not "\
+      << "supported with mghotDecomposition, solving stages in turn." << endl;
+    pipelineMGHOT = false;
+  }
+
   // Check if the P1 approximation should be used
   if ((*input)["parameters"]["mgqd-bcs"])
   {
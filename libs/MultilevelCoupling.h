@@ -13,6 +13,14 @@
 #include "GreyGroupQD.h"
 #include "WriteData.h"
 #include "PETScWrapper.h"
+#include "SolutionHistory.h"
+#include "MGHOTPolicy.h"
+#include "Checkpoint.h"
+#include "Diagnostics.h"
+#include "ConvergenceTrace.h"
+#include "CoarseMeshTransport.h"
+#include "Profiler.h"
+#include "Logger.h"
 
 using namespace std;
 
@@ -31,12 +39,43 @@ class MultilevelCoupling
     double resetThreshold = 1E100, relaxTolELOT = 3E-4, relaxTolMGLOQD = 3E-4,\
            ratedPower = 8e6, epsK = 1E-8;
     bool p1Approx = false, iterativeMGLOQD = false, iterativeELOT = false;
+
+    // Compute each group's Eddington factors while later groups sweep
+    bool pipelineMGHOT = false;
+
+    // Extrapolation of initial guesses from previous time steps
+    int extrapolationOrder = 0, historyLength = 0;
+    bool predictTemperature = false;
+    SolutionHistory * elotHistory, * mgloqdHistory;
+
+    // MGHOT solves performed in the most recent time step
+    int lastStepItersMGHOT = 0;
+
+    // Policy for skipping MGHOT solves when Eddington factors drift slowly
+    MGHOTPolicy * mghotPolicy;
+
+    // In-situ reductions written every step
+    Diagnostics * diagnostics;
+
+    // Per-iteration residuals and relaxation decisions
+    ConvergenceTrace * trace;
+
+    // MGHOT sweeps on a coarsened mesh, used when enabled
+    CoarseMeshTransport * coarseMGHOT;
+
+    // Checkpoint/restart of long transients
+    int checkpointInterval = 0;
+    string checkpointFile = "checkpoint.qmc", restartFile = "";
+
+    // Directory of converged steady states keyed by a hash of the input
+    string steadyStateCache = "";
     bool solveOneStep();
     bool solveOneStepResidualBalance(bool outputVars);
     void solveSteadyStateResidualBalance(bool outputVars);
     void solveSteadyStateTransientResidualBalance(bool outputVars);
     bool initialSolve();
     void solveMGHOT();
+    bool solveMGHOTPipelined();
     void solveSteadyStateMGHOT();
     void solveMGLOQD();
     void solveSteadyStateMGLOQD();
@@ -47,6 +86,14 @@ class MultilevelCoupling
         Eigen::MatrixXd volume, double kold);
     double eps(double residual, double relaxationTolerance = 1E-14);
     double relaxedEpsK(double residual, double relaxationTolerance = 1E-14);
+    bool predictInitialGuess();
+    void storeSolutionHistory(bool reset = false);
+    void transferState(Checkpoint * archive);
+    bool writeCheckpoint(string fileName);
+    bool readCheckpoint(string fileName);
+    bool readSteadyStateCache(bool outputVars);
+    void writeSteadyStateCache();
+    string calcSteadyStateHash();
     void checkOptionalParameters();
     string outputDir = "Solve_Metrics/";
     
@@ -63,6 +110,8 @@ class MultilevelCoupling
     void solveSteadyStateTransientResidualBalance_p(bool outputVars);
     void solveMGLOQD_p();
     void solveELOT_p();
+    bool predictInitialGuess_p();
+    void storeSolutionHistory_p(bool reset = false);
     
 
   private:
@@ -74,6 +123,9 @@ class MultilevelCoupling
     MultiGroupQD * mgqd;
     TransportToQDCoupling * MGTToMGQD; 
     MGQDToMPQDCoupling * MGQDToMPQD; 
+    void transferHistory(Checkpoint * archive,string name,\
+        SolutionHistory * history);
+    int scatterToAll_p(Vec * source,Vec * copy);
 };
 
 //==============================================================================
@@ -80,13 +80,15 @@ int initPETScVec(Vec *x, int size)
 int eigenVecToPETScVec(Eigen::VectorXd *x_e,Vec *x_p)
 {
   PetscErrorCode ierr;
-  
-  for (int idx = 0; idx < (*x_e).size(); idx++)
-  {
-    ierr = VecSetValue(*x_p,idx,(*x_e)(idx),INSERT_VALUES);CHKERRQ(ierr); 
-  }
-  ierr = VecAssemblyBegin(*x_p);CHKERRQ(ierr);
-  ierr = VecAssemblyEnd(*x_p);CHKERRQ(ierr);
+  PetscScalar *values;
+  OwnedRows rows;
+
+  /* Every rank holds all of x_e, so each only fills the entries it owns */
+  ierr = getOwnedRows(x_p,&rows);CHKERRQ(ierr);
+  ierr = VecGetArray(*x_p,&values);CHKERRQ(ierr);
+  for (PetscInt idx = rows.begin; idx < rows.end; idx++)
+    values[idx-rows.begin] = (*x_e)(idx);
+  ierr = VecRestoreArray(*x_p,&values);CHKERRQ(ierr);
   
   return ierr;
 }
@@ -94,7 +96,7 @@ int eigenVecToPETScVec(Eigen::VectorXd *x_e,Vec *x_p)
 int petscVecToEigenVec(Vec *x_p,Eigen::VectorXd *x_e)
 {
   PetscErrorCode ierr;
-  PetscScalar value;
+  const PetscScalar *values;
   PetscInt vecSize;
   VecScatter     ctx;
   Vec temp;
@@ -104,15 +106,13 @@ int petscVecToEigenVec(Vec *x_p,Eigen::VectorXd *x_e)
   VecScatterBegin(ctx,*x_p,temp,INSERT_VALUES,SCATTER_FORWARD);
   VecScatterEnd(ctx,*x_p,temp,INSERT_VALUES,SCATTER_FORWARD);
 
-  // Set set of Eigen vector
+  // Copy the gathered values into the Eigen vector in one pass
   ierr = VecGetSize(*x_p, &vecSize);
-  (*x_e).setZero(vecSize);
-
-  for (int idx = 0; idx < vecSize; idx++)
-  {
-    ierr = VecGetValues(temp,1,&idx,&value);CHKERRQ(ierr);
-    (*x_e)(idx) = value;
-  }
+  (*x_e).resize(vecSize);
+  ierr = VecGetArrayRead(temp,&values);CHKERRQ(ierr);
+  for (PetscInt idx = 0; idx < vecSize; idx++)
+    (*x_e)(idx) = values[idx];
+  ierr = VecRestoreArrayRead(temp,&values);CHKERRQ(ierr);
   
   VecScatterDestroy(&ctx);
   VecDestroy(&temp);
@@ -120,5 +120,23 @@ int petscVecToEigenVec(Vec *x_p,Eigen::VectorXd *x_e)
   return ierr;
 }
 
+int getOwnedRows(Mat *A,OwnedRows *rows)
+{
+  PetscErrorCode ierr;
+
+  ierr = MatGetOwnershipRange(*A,&(rows->begin),&(rows->end));CHKERRQ(ierr);
+
+  return ierr;
+}
+
+int getOwnedRows(Vec *x,OwnedRows *rows)
+{
+  PetscErrorCode ierr;
+
+  ierr = VecGetOwnershipRange(*x,&(rows->begin),&(rows->end));CHKERRQ(ierr);
+
+  return ierr;
+}
+
 
 //==============================================================================
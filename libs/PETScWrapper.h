@@ -7,6 +7,16 @@
 
 using namespace std;
 
+//==============================================================================
+//! Contiguous block of rows of a distributed matrix or vector held by this
+///   rank. Each rank only assembles the rows it owns.
+
+struct OwnedRows
+{
+  PetscInt begin = 0,end = 0;
+  bool contains(PetscInt iRow) const {return iRow >= begin and iRow < end;};
+};
+
 //==============================================================================
 
 int initPETScMat(Mat * A, int squareSize, int nonZeros);
@@ -14,6 +24,8 @@ int initPETScRectMat(Mat * A, int rows, int cols, int nonZeros);
 int initPETScVec(Vec * A, int size);
 int eigenVecToPETScVec(Eigen::VectorXd * x_e,Vec * x_p);
 int petscVecToEigenVec(Vec * x_p,Eigen::VectorXd * x_e);
+int getOwnedRows(Mat * A,OwnedRows * rows);
+int getOwnedRows(Vec * x,OwnedRows * rows);
 
 //==============================================================================
 
@@ -0,0 +1,233 @@
+// File: Profiler.cpp     
+// Purpose: Nested timers and counters for instrumenting the multilevel solver
+// Date: October 18, 2026
+
+#include "Profiler.h"
+#include "WriteData.h"
+
+using namespace std;
+
+thread_local vector<string> Profiler::pathStack;
+
+//==============================================================================
+/// Profiler class object constructor
+///
+/// @param [in] myMesh mesh object 
+Profiler::Profiler(Mesh * myMesh)
+{
+
+  int initialized = 0;
+
+  mesh = myMesh;
+
+  MPI_Initialized(&initialized);
+  if (initialized)
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Enter a timed region on this thread
+///
+/// @param [in] name name of region
+/// @return full path of region
+string Profiler::push(const char * name)
+{
+
+  string path = name;
+
+  if (path.find('/') == string::npos and not pathStack.empty())
+    path = pathStack.back() + "/" + path;
+
+  pathStack.push_back(path);
+
+  return path;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Leave a timed region on this thread and accumulate its time 
+///
+/// @param [in] path full path of region
+/// @param [in] seconds time spent in region
+void Profiler::pop(string path,double seconds)
+{
+
+  pathStack.pop_back();
+
+  lock_guard<mutex> lock(profileMutex);
+  Timer & timer = timers[path];
+  timer.calls++;
+  timer.stepCalls++;
+  timer.seconds += seconds;
+  timer.stepSeconds += seconds;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Full path of the innermost timed region open on this thread. Work handed
+/// to other threads can use it to time regions under the right parent.
+///
+/// @return full path of region, empty if none is open
+string Profiler::currentPath()
+{
+
+  if (pathStack.empty())
+    return "";
+
+  return pathStack.back();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Increment a counter
+///
+/// @param [in] name name of counter
+/// @param [in] increment amount to add
+void Profiler::count(const char * name,double increment)
+{
+
+  if (not enabled and not counting)
+    return;
+
+  lock_guard<mutex> lock(profileMutex);
+  counters[name] += increment;
+  stepCounters[name] += increment;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Total of a counter over the run so far
+///
+/// @param [in] name name of counter
+/// @return value of counter, or zero if it was never incremented
+double Profiler::counter(const char * name)
+{
+
+  lock_guard<mutex> lock(profileMutex);
+
+  auto found = counters.find(name);
+  if (found == counters.end())
+    return 0.0;
+
+  return found->second;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Append the timers and counters accumulated since the last call to the 
+/// per-step trace, labeled with the time at the present state
+///
+void Profiler::endStep()
+{
+
+  string dir;
+  double time = mesh->ts[mesh->state];
+
+  if (not enabled)
+    return;
+
+  lock_guard<mutex> lock(profileMutex);
+
+  if (rank == 0 and not traceFile.is_open())
+  {
+    dir = mesh->output->getOutputPath(outputDir,true);
+    mesh->output->makePath(dir);
+    traceFile.open(dir + "trace.csv");
+    traceFile << "time,type,name,calls,value" << endl;
+  }
+
+  // Other ranks only reset their per-step totals
+  traceFile << setprecision(10);
+  for (auto & timer : timers)
+  {
+    if (timer.second.stepCalls == 0)
+      continue;
+    if (rank == 0)
+      traceFile << time << ",timer," << timer.first << ","\
+        << timer.second.stepCalls << "," << timer.second.stepSeconds << endl;
+    timer.second.stepCalls = 0;
+    timer.second.stepSeconds = 0.0;
+  }
+  for (auto & counter : stepCounters)
+    if (rank == 0)
+      traceFile << time << ",counter," << counter.first << ",," \
+        << counter.second << endl;
+  stepCounters.clear();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write totals over the run
+///
+void Profiler::writeReport()
+{
+
+  string dir;
+  ofstream report;
+
+  if (not enabled or rank != 0)
+    return;
+
+  lock_guard<mutex> lock(profileMutex);
+
+  dir = mesh->output->getOutputPath(outputDir,true);
+  mesh->output->makePath(dir);
+  report.open(dir + "profile.csv");
+
+  report << "type,name,calls,value" << endl;
+  report << setprecision(10);
+  for (auto & timer : timers)
+    report << "timer," << timer.first << "," << timer.second.calls << ","\
+      << timer.second.seconds << endl;
+  for (auto & counter : counters)
+    report << "counter," << counter.first << ",," << counter.second << endl;
+
+  report.close();
+  traceFile.close();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// ScopedTimer class object constructor. Starts timing if profiling is
+/// enabled.
+///
+/// @param [in] myProfiler profiler to report to 
+/// @param [in] name name of timed region
+ScopedTimer::ScopedTimer(Profiler * myProfiler,const char * name)
+{
+
+  profiler = NULL;
+  if (myProfiler == NULL or not myProfiler->enabled)
+    return;
+
+  profiler = myProfiler;
+  path = profiler->push(name);
+  begin = chrono::high_resolution_clock::now();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// ScopedTimer class object destructor. Stops timing.
+///
+ScopedTimer::~ScopedTimer()
+{
+
+  if (profiler == NULL)
+    return;
+
+  auto end = chrono::high_resolution_clock::now();
+  auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+  profiler->pop(path,elapsed.count()*1e-9);
+
+};
+//==============================================================================
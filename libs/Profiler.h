@@ -0,0 +1,67 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <map>
+#include <mutex>
+#include <fstream>
+#include "Mesh.h"
+
+using namespace std;
+
+//==============================================================================
+//! Accumulates nested timers and counters over a run and writes a per-run 
+///   report and per-step trace. Does nothing unless enabled, except that 
+///   counters also accumulate when counting is set. Only rank 0 writes 
+///   under MPI.
+
+class Profiler
+{
+  public:
+    Profiler(Mesh * myMesh);
+    bool enabled = false,counting = false;
+    string outputDir = "Profile/";
+    string push(const char * name);
+    void pop(string path,double seconds);
+    string currentPath();
+    void count(const char * name,double increment = 1.0);
+    double counter(const char * name);
+    void endStep();
+    void writeReport();
+
+  private:
+    struct Timer
+    {
+      long long calls = 0,stepCalls = 0;
+      double seconds = 0.0,stepSeconds = 0.0;
+    };
+    map<string,Timer> timers;
+    map<string,double> counters,stepCounters;
+    mutex profileMutex;
+    ofstream traceFile;
+    int rank = 0;
+    Mesh * mesh;
+    static thread_local vector<string> pathStack;
+};
+
+//==============================================================================
+
+//==============================================================================
+//! Times the enclosing scope. Nested timers on the same thread are reported 
+///   as children of the enclosing timer; a name containing '/' is taken as a
+///   full path instead.
+
+class ScopedTimer
+{
+  public:
+    ScopedTimer(Profiler * myProfiler,const char * name);
+    ~ScopedTimer();
+
+  private:
+    Profiler * profiler;
+    string path;
+    chrono::high_resolution_clock::time_point begin;
+};
+
+//==============================================================================
+
+#endif
@@ -5,6 +5,10 @@
 #include "QuasidiffusionSolver.h"
 #include "SingleGroupQD.h"
 #include "GreyGroupQD.h"
+#include "Profiler.h"
+#include "Logger.h"
+#include "Scheduler.h"
+#include "StaticCondensation.h"
 
 using namespace std; 
 
@@ -40,10 +44,12 @@ QDSolver::QDSolver(Mesh * myMesh,\
   A.reserve(3*nUnknowns+nUnknowns/5);
   C.resize(nCurrentUnknowns,nUnknowns);
   C.reserve(4*nCurrentUnknowns);
-  x.setZero(nUnknowns);
+  x.resize(nUnknowns);
+  mesh->scheduler->firstTouch(x.data(),nUnknowns,Scheduler::assembly);
   xPast.setZero(nUnknowns);
   currPast.setZero(energyGroups*nGroupCurrentUnknowns);
-  b.setZero(nUnknowns);
+  b.resize(nUnknowns);
+  mesh->scheduler->firstTouch(b.data(),nUnknowns,Scheduler::assembly);
   d.setZero(nCurrentUnknowns);
 
   /* Initialize PETSc variables */
@@ -63,6 +69,28 @@ QDSolver::QDSolver(Mesh * myMesh,\
   initPETScVec(&currPast_p_seq,nCurrentUnknowns);
 
   checkOptionalParams();
+
+  // The zeroth moment equations of a cell couple its center fluxes in every
+  // group to each other and to its own face fluxes only, so the center fluxes
+  // can be eliminated cell by cell
+  if (condense)
+  {
+    vector< vector<int> > cellBlocks;
+    vector<int> indices;
+    for (int iR = 0; iR < nR; iR++)
+    {
+      for (int iZ = 0; iZ < nZ; iZ++)
+      {
+        cellBlocks.push_back(vector<int>());
+        for (int iGroup = 0; iGroup < energyGroups; iGroup++)
+        {
+          indices = getIndices(iR,iZ,iGroup);
+          cellBlocks.back().push_back(indices[iCF]);
+        }
+      }
+    }
+    condensation = new StaticCondensation(mesh,nUnknowns,cellBlocks);
+  }
 };
 
 //==============================================================================
@@ -206,6 +234,7 @@ void QDSolver::formSteadyStateLinearSystem(SingleGroupQD * SGQD)
 void QDSolver::solve()
 {
   
+  condensed = condense and condensation->condense(A,b);
   solveSuperLU();
 
 };
@@ -224,6 +253,8 @@ void QDSolver::solveIterative()
   int solveOutcome;
   //cout << "number procs: " << n << endl;
 
+  condensed = condense and condensation->condense(A,b);
+
   if (preconditioner == iluPreconditioner) 
     solveOutcome = solveIterativeILU();
   else if (preconditioner == diagPreconditioner)
@@ -231,16 +262,17 @@ void QDSolver::solveIterative()
     solveOutcome = solveIterativeDiag();
     if (solveOutcome != Eigen::Success)
     {
-      cout << "        " << "BiCGSTAB solve failed! Attempting iterative";
-      cout << " solve with ILU preconditioner." << endl;
+      mesh->logger->warning("QDSolver") \
+        << "        BiCGSTAB solve failed! Attempting iterative" \
+        << " solve with ILU preconditioner." << endl;
       solveOutcome = solveIterativeILU();
     }
   }
 
   if (solveOutcome != Eigen::Success)
   {
-    cout << "        " << "Iterative solve failed! ";
-    cout << "Using SuperLU direct solve.";  
+    mesh->logger->warning("QDSolver") \
+      << "        Iterative solve failed! Using SuperLU direct solve." << endl;
     solveSuperLU();
   }
 
@@ -260,11 +292,21 @@ int QDSolver::solveSuperLU()
   auto begin = chrono::high_resolution_clock::now();
   Eigen::SuperLU<Eigen::SparseMatrix<double>> solverLU;
   A.makeCompressed();
-  solverLU.compute(A);
-  x = solverLU.solve(b);
+
+  // Solve the condensed system instead if one was formed
+  Eigen::SparseMatrix<double,Eigen::RowMajor> & systemA = \
+    condensed ? condensation->reducedA : A;
+  Eigen::VectorXd & systemB = condensed ? condensation->reducedB : b;
+
+  solverLU.compute(systemA);
+  mesh->profiler->count("factorizations");
+  x = solverLU.solve(systemB);
+  if (condensed)
+    x = condensation->expandSolution(x);
   auto end = chrono::high_resolution_clock::now();
   auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
-  cout << "solve time: " << elapsed.count()*1e-9 << endl;
+  mesh->logger->iteration("QDSolver") << "solve time: " << elapsed.count()*1e-9 \
+    << endl;
   //cout << "EIGEN x:" << x << endl;
 
   // Return outcome of solve
@@ -281,6 +323,7 @@ int QDSolver::solveIterativeILU()
 {
 
   int success;
+  Eigen::VectorXd xGuess;
 
   // Declare solver with ILUT preconditioner
   Eigen::BiCGSTAB<Eigen::SparseMatrix<double,Eigen::RowMajor>,\
@@ -295,22 +338,27 @@ int QDSolver::solveIterativeILU()
   //solver.setTolerance(1E-14);
   //solver.setMaxIterations(20);
 
-  // Solve system
+  // Solve the condensed system instead if one was formed
+  Eigen::SparseMatrix<double,Eigen::RowMajor> & systemA = \
+    condensed ? condensation->reducedA : A;
+  Eigen::VectorXd & systemB = condensed ? condensation->reducedB : b;
+
+  // Solve system, starting from the current contents of x
+  xGuess = condensed ? condensation->restrictSolution(x) : x;
   A.makeCompressed();
-  solver.analyzePattern(A);
-  solver.factorize(A);
-  x = solver.solve(b);
+  solver.analyzePattern(systemA);
+  solver.factorize(systemA);
+  x = solver.solveWithGuess(systemB,xGuess);
+  if (condensed)
+    x = condensation->expandSolution(x);
+  mesh->profiler->count("krylovIterations",solver.iterations());
 
   if (mesh->verbose) 
   {
-    cout << "        ";
-    cout << "info:     " << solver.info() << endl;
-    cout << "        ";
-    cout << "#iterations:     " << solver.iterations() << endl;
-    cout << "        ";
-    cout << "estimated error: " << solver.error() << endl;
-    cout << "        ";
-    cout << "tolerance: " << solver.tolerance() << endl;
+    mesh->logger->info("QDSolver") << "        info:     " << solver.info() \
+      << endl << "        #iterations:     " << solver.iterations() << endl \
+      << "        estimated error: " << solver.error() << endl \
+      << "        tolerance: " << solver.tolerance() << endl;
   }
 
   // Return outcome of solve
@@ -327,6 +375,7 @@ int QDSolver::solveIterativeDiag()
 {
 
   int success;
+  Eigen::VectorXd xGuess;
 
   // Declare solver with default diagonal precondition (cheaper to calculate) 
   // but usually requires more iterations to converge
@@ -336,22 +385,27 @@ int QDSolver::solveIterativeDiag()
   //solver.setTolerance(1E-14);
   //solver.setMaxIterations(20);
 
-  // Solve system
+  // Solve the condensed system instead if one was formed
+  Eigen::SparseMatrix<double,Eigen::RowMajor> & systemA = \
+    condensed ? condensation->reducedA : A;
+  Eigen::VectorXd & systemB = condensed ? condensation->reducedB : b;
+
+  // Solve system, starting from the current contents of x
+  xGuess = condensed ? condensation->restrictSolution(x) : x;
   A.makeCompressed();
-  solver.analyzePattern(A);
-  solver.factorize(A);
-  x = solver.solve(b);
+  solver.analyzePattern(systemA);
+  solver.factorize(systemA);
+  x = solver.solveWithGuess(systemB,xGuess);
+  if (condensed)
+    x = condensation->expandSolution(x);
+  mesh->profiler->count("krylovIterations",solver.iterations());
 
   if (mesh->verbose) 
   {
-    cout << "        ";
-    cout << "info:     " << solver.info() << endl;
-    cout << "        ";
-    cout << "#iterations:     " << solver.iterations() << endl;
-    cout << "        ";
-    cout << "estimated error: " << solver.error() << endl;
-    cout << "        ";
-    cout << "tolerance: " << solver.tolerance() << endl;
+    mesh->logger->info("QDSolver") << "        info:     " << solver.info() \
+      << endl << "        #iterations:     " << solver.iterations() << endl \
+      << "        estimated error: " << solver.error() << endl \
+      << "        tolerance: " << solver.tolerance() << endl;
   }
 
   // Return outcome of solve
@@ -2729,6 +2783,10 @@ Eigen::VectorXd QDSolver::getCurrentSolutionVector(SingleGroupQD * SGQD)
 void QDSolver::formSteadyStateLinearSystem_p(SingleGroupQD * SGQD)	      
 {
   int iEq = SGQD->energyGroup*nGroupUnknowns;
+  OwnedRows rows;
+
+  // Only assemble the rows this rank owns
+  getOwnedRows(&A_p,&rows);
 
   // loop over spatial mesh
   for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
@@ -2737,7 +2795,8 @@ void QDSolver::formSteadyStateLinearSystem_p(SingleGroupQD * SGQD)
     {
 
       // apply zeroth moment equation
-      assertSteadyStateZerothMoment_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+      if (rows.contains(iEq))
+        assertSteadyStateZerothMoment_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
       iEq = iEq + 1;
 
 
@@ -2745,12 +2804,14 @@ void QDSolver::formSteadyStateLinearSystem_p(SingleGroupQD * SGQD)
       if (iZ == mesh->dzsCorner.size()-1)
       {
         // if on the boundary, assert boundary conditions
-        assertSteadyStateSBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          assertSteadyStateSBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } else
       {
         // otherwise assert first moment balance on south face
-        applySteadyStateAxialBoundary_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          applySteadyStateAxialBoundary_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       }
 
@@ -2758,12 +2819,14 @@ void QDSolver::formSteadyStateLinearSystem_p(SingleGroupQD * SGQD)
       if (iR == mesh->drsCorner.size()-1)
       {
         // if on the boundary, assert boundary conditions
-        assertSteadyStateEBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          assertSteadyStateEBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } else
       {
         // otherwise assert first moment balance on north face
-        applySteadyStateRadialBoundary_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          applySteadyStateRadialBoundary_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       }
 
@@ -2771,7 +2834,8 @@ void QDSolver::formSteadyStateLinearSystem_p(SingleGroupQD * SGQD)
       if (iZ == 0)
       {
         // if on the boundary, assert boundary conditions
-        assertSteadyStateNBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          assertSteadyStateNBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } 
 
@@ -2779,7 +2843,8 @@ void QDSolver::formSteadyStateLinearSystem_p(SingleGroupQD * SGQD)
       if (iR == 0)
       {
         // if on the boundary, assert boundary conditions
-        assertSteadyStateWBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          assertSteadyStateWBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } 
 
@@ -3564,6 +3629,10 @@ int QDSolver::assertEFluxBC_p(int iR,int iZ,int iEq,int energyGroup,\
 void QDSolver::formSteadyStateBackCalcSystem_p(SingleGroupQD * SGQD)	      
 {
   int iEq = SGQD->energyGroup*nGroupCurrentUnknowns;
+  OwnedRows rows;
+
+  // Only assemble the rows this rank owns
+  getOwnedRows(&C_p,&rows);
 
   // loop over spatial mesh
   for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
@@ -3572,17 +3641,20 @@ void QDSolver::formSteadyStateBackCalcSystem_p(SingleGroupQD * SGQD)
     {
 
       // south face
-      calcSteadyStateSouthCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+      if (rows.contains(iEq))
+        calcSteadyStateSouthCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
       iEq = iEq + 1;
 
       // east face
-      calcSteadyStateEastCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+      if (rows.contains(iEq))
+        calcSteadyStateEastCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
       iEq = iEq + 1;
 
       // north face
       if (iZ == 0)
       {
-        calcSteadyStateNorthCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          calcSteadyStateNorthCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } 
 
@@ -3590,7 +3662,8 @@ void QDSolver::formSteadyStateBackCalcSystem_p(SingleGroupQD * SGQD)
       if (iR == 0)
       {
         // if on the boundary, assert boundary conditions
-        calcSteadyStateWestCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          calcSteadyStateWestCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } 
 
@@ -3925,15 +3998,20 @@ int QDSolver::solve_p()
   ierr = KSPGetPC(ksp,&pc);CHKERRQ(ierr);
   ierr = PCSetType(pc,PetscPreconditioner.c_str());CHKERRQ(ierr);
 
+  /* Start from the current contents of x_p */
+  ierr = KSPSetInitialGuessNonzero(ksp,PETSC_TRUE);CHKERRQ(ierr);
+
   /* Solve the system */
   ierr = KSPSolve(ksp,b_p,x_p);CHKERRQ(ierr);
   auto end = chrono::high_resolution_clock::now();
   auto elapsed = chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
   //ierr = VecView(x_p,PETSC_VIEWER_STDOUT_WORLD);CHKERRQ(ierr);
-  cout << "solve time: " << elapsed.count()*1e-9 << endl;
+  mesh->logger->iteration("QDSolver") << "solve time: " << elapsed.count()*1e-9 \
+    << endl;
 
   /* Print solve information */
   ierr = KSPGetIterationNumber(ksp,&its);CHKERRQ(ierr);
+  mesh->profiler->count("krylovIterations",its);
   
   /* Destroy solver */
   ierr = KSPDestroy(&ksp);CHKERRQ(ierr);
@@ -3956,6 +4034,10 @@ int QDSolver::solve_p()
 void QDSolver::formLinearSystem_p(SingleGroupQD * SGQD)	      
 {
   int iEq = SGQD->energyGroup*nGroupUnknowns;
+  OwnedRows rows;
+
+  // Only assemble the rows this rank owns
+  getOwnedRows(&A_p,&rows);
 
   // loop over spatial mesh
   for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
@@ -3964,19 +4046,22 @@ void QDSolver::formLinearSystem_p(SingleGroupQD * SGQD)
     {
 
       // apply zeroth moment equation
-      assertZerothMoment_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+      if (rows.contains(iEq))
+        assertZerothMoment_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
       iEq = iEq + 1;
 
       // south face
       if (iZ == mesh->dzsCorner.size()-1)
       {
         // if on the boundary, assert boundary conditions
-        assertSBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          assertSBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } else
       {
         // otherwise assert first moment balance on south face
-        applyAxialBoundary_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          applyAxialBoundary_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       }
 
@@ -3984,12 +4069,14 @@ void QDSolver::formLinearSystem_p(SingleGroupQD * SGQD)
       if (iR == mesh->drsCorner.size()-1)
       {
         // if on the boundary, assert boundary conditions
-        assertEBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          assertEBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } else
       {
         // otherwise assert first moment balance on north face
-        applyRadialBoundary_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          applyRadialBoundary_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       }
 
@@ -3997,7 +4084,8 @@ void QDSolver::formLinearSystem_p(SingleGroupQD * SGQD)
       if (iZ == 0)
       {
         // if on the boundary, assert boundary conditions
-        assertNBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          assertNBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } 
 
@@ -4005,7 +4093,8 @@ void QDSolver::formLinearSystem_p(SingleGroupQD * SGQD)
       if (iR == 0)
       {
         // if on the boundary, assert boundary conditions
-        assertWBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          assertWBC_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } 
 
@@ -4780,6 +4869,10 @@ int QDSolver::greyGroupSources_p(int iR,int iZ,int iEq,int toEnergyGroup,\
 void QDSolver::formBackCalcSystem_p(SingleGroupQD * SGQD)	      
 {
   int iEq = SGQD->energyGroup*nGroupCurrentUnknowns;
+  OwnedRows rows;
+
+  // Only assemble the rows this rank owns
+  getOwnedRows(&C_p,&rows);
 
   // loop over spatial mesh
   for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
@@ -4788,17 +4881,20 @@ void QDSolver::formBackCalcSystem_p(SingleGroupQD * SGQD)
     {
 
       // south face
-      calcSouthCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+      if (rows.contains(iEq))
+        calcSouthCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
       iEq = iEq + 1;
 
       // east face
-      calcEastCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+      if (rows.contains(iEq))
+        calcEastCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
       iEq = iEq + 1;
 
       // north face
       if (iZ == 0)
       {
-        calcNorthCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          calcNorthCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } 
 
@@ -4806,7 +4902,8 @@ void QDSolver::formBackCalcSystem_p(SingleGroupQD * SGQD)
       if (iR == 0)
       {
         // if on the boundary, assert boundary conditions
-        calcWestCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
+        if (rows.contains(iEq))
+          calcWestCurrent_p(iR,iZ,iEq,SGQD->energyGroup,SGQD);
         iEq = iEq + 1;
       } 
 
@@ -5140,6 +5237,9 @@ void QDSolver::checkOptionalParams()
 
   }
 
+  if ((*input)["parameters"]["condenseMGLOQD"])
+    condense = (*input)["parameters"]["condenseMGLOQD"].as<bool>();
+
   if ((*input)["parameters"]["preconditionerMGLOQD"])
   {
     precondInput=(*input)["parameters"]["preconditionerMGLOQD"].as<string>();
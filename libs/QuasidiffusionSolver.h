@@ -8,6 +8,7 @@
 
 class SingleGroupQD;
 class GreyGroupQD;
+class StaticCondensation;
 
 using namespace std; 
 
@@ -219,6 +220,8 @@ class QDSolver
     bool goldinBCs = false;
     bool diffusionBCs = false;
     bool useMPQDSources = false;
+    bool condense = false,condensed = false;
+    StaticCondensation * condensation = NULL;
     MultiPhysicsCoupledQD * mpqd;
 
     /* PETSc stuff */
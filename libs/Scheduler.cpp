@@ -0,0 +1,215 @@
+// File: Scheduler.cpp
+// Purpose: Size, limit, and place the OpenMP threads shared by the solvers
+// Date: October 18, 2026
+
+#include <omp.h>
+#include <algorithm>
+#include <unistd.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+#include "Scheduler.h"
+#include "Logger.h"
+
+using namespace std;
+
+//==============================================================================
+/// Scheduler class object constructor
+///
+/// @param [in] myMesh mesh object
+Scheduler::Scheduler(Mesh * myMesh)
+{
+
+  int initialized = 0;
+  MPI_Comm nodeComm;
+
+  mesh = myMesh;
+
+  // Ranks that share a node are pinned to disjoint sets of cores
+  MPI_Initialized(&initialized);
+  if (initialized)
+  {
+    MPI_Comm_split_type(PETSC_COMM_WORLD,MPI_COMM_TYPE_SHARED,0,\
+      MPI_INFO_NULL,&nodeComm);
+    MPI_Comm_rank(nodeComm,&localRank);
+    MPI_Comm_size(nodeComm,&nLocalRanks);
+    MPI_Comm_free(&nodeComm);
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Number of threads a phase may use
+///
+/// @param [in] phase solver phase asking for threads
+/// @return limit of the phase, or the size of the team if it has none
+int Scheduler::threads(Phase phase)
+{
+
+  if (limits[phase] > 0)
+    return min(limits[phase],nThreads);
+
+  return nThreads;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Zero a newly allocated array. With numaFirstTouch each thread writes the
+/// static chunk it gets in a phase's loops first, so the pages of that chunk
+/// are placed on the thread's own socket.
+///
+/// @param [in] data first entry of the array
+/// @param [in] size number of entries
+/// @param [in] phase phase whose loops will mostly use the array
+void Scheduler::firstTouch(double * data,long long size,Phase phase)
+{
+
+  #pragma omp parallel for schedule(static) if(numaFirstTouch) \
+    num_threads(threads(phase))
+  for (long long i = 0; i < size; i++)
+    data[i] = 0.0;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Zero a newly allocated angular flux cube. With numaFirstTouch the radial
+/// columns of every slice are divided among the threads in the way the
+/// moment loops divide them.
+///
+/// @param [in] field cube, already sized
+/// @param [in] phase phase whose loops will mostly use the cube
+void Scheduler::firstTouch(arma::cube & field,Phase phase)
+{
+
+  int nRows = field.n_rows,nCols = field.n_cols,nSlices = field.n_slices;
+
+  #pragma omp parallel for schedule(static) if(numaFirstTouch) \
+    num_threads(threads(phase))
+  for (int iCol = 0; iCol < nCols; iCol++)
+  {
+    for (int iSlice = 0; iSlice < nSlices; iSlice++)
+    {
+      double * column = field.memptr() + ((long long)iSlice*nCols + iCol)*nRows;
+      fill(column,column + nRows,0.0);
+    }
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Size the OpenMP team and Eigen's kernels, then place the threads
+///
+void Scheduler::configure()
+{
+
+  Eigen::initParallel();
+  omp_set_num_threads(nThreads);
+  Eigen::setNbThreads(threads(eigen));
+
+  bindThreads();
+
+  mesh->logger->info("Scheduler") << nThreads << " threads (sweep " \
+    << threads(sweep) << ", assembly " << threads(assembly) << ", moments " \
+    << threads(moments) << ", eigen " << threads(eigen) << ")" << endl;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Pin each thread of the OpenMP team to one core. The runtime reuses its
+/// threads across parallel regions, so the placement lasts for the run.
+/// "close" packs the threads of a rank onto neighbouring cores; "spread"
+/// strides them over every core of the node, and so over every socket.
+///
+void Scheduler::bindThreads()
+{
+
+  if (affinity == bindNone)
+    return;
+
+#ifdef __linux__
+  int nCores = sysconf(_SC_NPROCESSORS_ONLN);
+  int first = localRank*nThreads;
+  int stride = max(1,nCores/(nLocalRanks*nThreads));
+
+  #pragma omp parallel num_threads(nThreads)
+  {
+    int iThread = omp_get_thread_num(),core;
+    cpu_set_t cores;
+
+    if (affinity == bindSpread)
+      core = (first + iThread)*stride;
+    else
+      core = first + iThread;
+
+    CPU_ZERO(&cores);
+    CPU_SET(core % nCores,&cores);
+    sched_setaffinity(0,sizeof(cpu_set_t),&cores);
+  }
+#else
+  mesh->logger->warning("Scheduler") << "threadAffinity is only supported " \
+    << "on Linux." << endl;
+#endif
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Convert the name of a placement to an Affinity
+///
+/// @param [in] name one of none, close, or spread
+/// @return corresponding placement, or none if not recognized
+Scheduler::Affinity Scheduler::parseAffinity(string name)
+{
+
+  if (name == "close")
+    return bindClose;
+  else if (name == "spread")
+    return bindSpread;
+  else if (name != "none")
+    mesh->logger->warning("Scheduler") << "Unrecognized thread affinity " \
+      << name << ", using none." << endl;
+
+  return bindNone;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read threading parameters from the input file
+///
+/// @param [in] input YAML input object
+void Scheduler::checkOptionalParams(YAML::Node * input)
+{
+
+  YAML::Node params = (*input)["parameters"];
+
+  if (params["nprocs"])
+    nThreads = max(1,params["nprocs"].as<int>());
+
+  // Per phase limits, e.g. threadLimits: {sweep: 8, assembly: 4}
+  if (params["threadLimits"])
+  {
+    YAML::Node phaseLimits = params["threadLimits"];
+    if (phaseLimits["sweep"])
+      limits[sweep] = phaseLimits["sweep"].as<int>();
+    if (phaseLimits["assembly"])
+      limits[assembly] = phaseLimits["assembly"].as<int>();
+    if (phaseLimits["moments"])
+      limits[moments] = phaseLimits["moments"].as<int>();
+    if (phaseLimits["eigen"])
+      limits[eigen] = phaseLimits["eigen"].as<int>();
+  }
+
+  if (params["threadAffinity"])
+    affinity = parseAffinity(params["threadAffinity"].as<string>());
+
+  if (params["numaFirstTouch"])
+    numaFirstTouch = params["numaFirstTouch"].as<bool>();
+
+};
+//==============================================================================
@@ -0,0 +1,40 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "Mesh.h"
+
+using namespace std;
+
+//==============================================================================
+//! Owns the process-wide OpenMP thread team shared by every solver level.
+///   Each phase asks for its own concurrency limit, and the team's threads
+///   can be pinned to cores when the run starts.
+
+class Scheduler
+{
+  public:
+    Scheduler(Mesh * myMesh);
+
+    enum Phase {sweep = 0,assembly = 1,moments = 2,eigen = 3,nPhases = 4};
+    enum Affinity {bindNone = 0,bindClose = 1,bindSpread = 2};
+
+    int nThreads = 1;
+    Affinity affinity = bindNone;
+    bool numaFirstTouch = false;
+    int threads(Phase phase);
+    void firstTouch(double * data,long long size,Phase phase);
+    void firstTouch(arma::cube & field,Phase phase);
+    void configure();
+    void bindThreads();
+    void checkOptionalParams(YAML::Node * input);
+    Affinity parseAffinity(string name);
+
+  private:
+    Mesh * mesh;
+    int limits[nPhases] = {0,0,0,0};
+    int localRank = 0,nLocalRanks = 1;
+};
+
+//==============================================================================
+
+#endif
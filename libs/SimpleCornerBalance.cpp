@@ -3,6 +3,8 @@
 // Date: October 28, 2019
 
 #include "SimpleCornerBalance.h"
+#include "TransportDecomposition.h"
+#include "Scheduler.h"
 
 using namespace std; 
 
@@ -76,6 +78,11 @@ SimpleCornerBalance::SimpleCornerBalance(Mesh * myMesh,\
     std::fill(outerBC.begin(),outerBC.end(),0.0);
   } 
 
+  // Number of axial subdomains swept concurrently with lagged inflow
+  if ((*input)["parameters"]["sweepSubdomains"]){
+    nSubdomains = max(1,(*input)["parameters"]["sweepSubdomains"].as<int>());
+  }
+
 };
 
 //==============================================================================
@@ -97,9 +104,16 @@ void SimpleCornerBalance::solve(arma::cube * aFlux,\
 {
   for (int iXi = 0; iXi < mesh->quadrature.size(); ++iXi){
 
+    if (decomposition != NULL and not decomposition->owns(energyGroup,iXi))
+      continue;
+
     for (int iMu = 0; iMu < mesh->quadrature[iXi].nOrd; ++iMu){
     
-      solveAngularFlux(aFlux,halfAFlux,source,alpha,energyGroup,iXi,iMu);
+      if (nSubdomains > 1)
+        solveAngularFluxSubdomains(aFlux,halfAFlux,source,alpha,\
+          energyGroup,iXi,iMu);
+      else
+        solveAngularFlux(aFlux,halfAFlux,source,alpha,energyGroup,iXi,iMu);
 
     } //iMu
   } //iXi
@@ -111,25 +125,89 @@ void SimpleCornerBalance::solveAngularFlux(arma::cube * aFlux,\
   arma::cube * halfAFlux,\
   Eigen::MatrixXd * source,\
   Eigen::MatrixXd * alpha,\
-  int energyGroup,int iXi,int iMu){
+  int energyGroup,int iXi,int iMu,\
+  int zCellBegin,int zCellEnd,\
+  Eigen::VectorXd * inflow){
 
   double mu = mesh->quadrature[iXi].quad[iMu][1];
   
   if (mu > 0)
-    solveAngularFluxPosMu(aFlux,halfAFlux,source,alpha,energyGroup,iXi,iMu);
+    solveAngularFluxPosMu(aFlux,halfAFlux,source,alpha,energyGroup,iXi,iMu,\
+      zCellBegin,zCellEnd,inflow);
   else
-    solveAngularFluxNegMu(aFlux,halfAFlux,source,alpha,energyGroup,iXi,iMu);
+    solveAngularFluxNegMu(aFlux,halfAFlux,source,alpha,energyGroup,iXi,iMu,\
+      zCellBegin,zCellEnd,inflow);
 
 }
 //==============================================================================
 
 //==============================================================================
-void SimpleCornerBalance::solveAngularFluxNegMu(arma::cube * aFlux,\
+/// Sweep one ordinate over axial subdomains at once. Each subdomain takes 
+/// the angular flux entering through its upstream face from the previous
+/// sweep (block Jacobi), so the subdomains can be swept concurrently. The
+/// lagged inflow is converged away by the outer iterations. 
+///
+/// @param [out] aFlux Angular flux solutions are stored here
+/// @param [in] halfAFlux Half angle fluxes needed to solve transport equation
+/// @param [in] source Source in each cell
+/// @param [in] alpha Alpha in each cell
+/// @param [in] energyGroup Energy group associated with this solve
+/// @param [in] iXi quadrature level
+/// @param [in] iMu ordinate on the quadrature level
+void SimpleCornerBalance::solveAngularFluxSubdomains(arma::cube * aFlux,\
   arma::cube * halfAFlux,\
   Eigen::MatrixXd * source,\
   Eigen::MatrixXd * alpha,\
   int energyGroup,int iXi,int iMu){
 
+  double xi = mesh->quadrature[iXi].quad[0][0];
+  int angIdx = mesh->quadrature[iXi].ordIdx[iMu];
+  int nCellsZ = mesh->dzs.size(),nDomains = min(nSubdomains,nCellsZ);
+  int haloRow;
+  vector<int> zCellBounds(nDomains+1);
+  vector<Eigen::VectorXd> inflows(nDomains);
+
+  for (int iDomain = 0; iDomain <= nDomains; iDomain++)
+    zCellBounds[iDomain] = (iDomain*nCellsZ)/nDomains;
+
+  // Copy the corner row just upstream of each subdomain before any of them
+  // are overwritten by this sweep
+  for (int iDomain = 0; iDomain < nDomains; iDomain++)
+  {
+    if (xi > 0)
+      haloRow = 2*zCellBounds[iDomain]-1;
+    else
+      haloRow = 2*zCellBounds[iDomain+1];
+
+    if (haloRow < 0 or haloRow >= mesh->dzsCorner.size())
+      continue;
+
+    inflows[iDomain].resize(aFlux->n_cols);
+    for (int iR = 0; iR < aFlux->n_cols; iR++)
+      inflows[iDomain](iR) = (*aFlux)(haloRow,iR,angIdx);
+  }
+
+  #pragma omp parallel for schedule(dynamic) \
+    num_threads(mesh->scheduler->threads(Scheduler::sweep))
+  for (int iDomain = 0; iDomain < nDomains; iDomain++)
+  {
+    solveAngularFlux(aFlux,halfAFlux,source,alpha,energyGroup,iXi,iMu,\
+      zCellBounds[iDomain],zCellBounds[iDomain+1],\
+      inflows[iDomain].size() > 0 ? &inflows[iDomain] : NULL);
+  }
+
+}
+//==============================================================================
+
+//==============================================================================
+void SimpleCornerBalance::solveAngularFluxNegMu(arma::cube * aFlux,\
+  arma::cube * halfAFlux,\
+  Eigen::MatrixXd * source,\
+  Eigen::MatrixXd * alpha,\
+  int energyGroup,int iXi,int iMu,\
+  int zCellBegin,int zCellEnd,\
+  Eigen::VectorXd * inflow){
+
 
   // Index xi, mu, and weight values are stored in quadLevel object
   const int xiIndex=0,muIndex=1,etaIndex=2,weightIndex=3;
@@ -141,6 +219,10 @@ void SimpleCornerBalance::solveAngularFluxNegMu(arma::cube * aFlux,\
   xi = mesh->quadrature[iXi].quad[0][xiIndex];
   mu = mesh->quadrature[iXi].quad[iMu][muIndex];
 
+  // Sweep the whole axial extent unless given a subdomain
+  if (zCellEnd < 0)
+    zCellEnd = mesh->dzs.size();
+
   int zStart,rStart,zInc,borderCellZ,borderCellR,angIdx,zStartCell,\
     rStartCell;
 
@@ -243,8 +325,8 @@ void SimpleCornerBalance::solveAngularFluxNegMu(arma::cube * aFlux,\
   if (xi > 0) {
 
     // Marching from the bottom to the top
-    zStart = 0;
-    zStartCell = 0;
+    zStart = 2*zCellBegin;
+    zStartCell = zCellBegin;
     zInc = 2;
     borderCellZ = -1;
     
@@ -266,8 +348,8 @@ void SimpleCornerBalance::solveAngularFluxNegMu(arma::cube * aFlux,\
   else {			
 
     // Marching from the top to the bottom
-    zStart = mesh->dzsCorner.size()-1;
-    zStartCell = mesh->dzs.size()-1;
+    zStart = 2*zCellEnd-1;
+    zStartCell = zCellEnd-1;
     zInc = -2;
     borderCellZ = 1;
   
@@ -292,7 +374,7 @@ void SimpleCornerBalance::solveAngularFluxNegMu(arma::cube * aFlux,\
     iR = iR - 2, --iCellR,countR = countR + 2){
     
     for (int iZ = zStart, iCellZ = zStartCell,countZ = 0;\
-      countZ < mesh->dzsCorner.size();\
+      countZ < 2*(zCellEnd-zCellBegin);\
       iZ = iZ + zInc,iCellZ = iCellZ + zInc/2,countZ = countZ + 2){
      
       // Set source in each corner
@@ -423,6 +505,16 @@ void SimpleCornerBalance::solveAngularFluxNegMu(arma::cube * aFlux,\
 
         b = b - upstream;
 
+      } else if (inflow != NULL){
+
+        // Lagged values from the neighbouring subdomain
+        upstream =\
+        xi*(*inflow)(iR+cornerOffset(outUpstreamZ[0],0))\
+        *lZ.col(outUpstreamZ[0])+\
+        xi*(*inflow)(iR+cornerOffset(outUpstreamZ[1],0))\
+        *lZ.col(outUpstreamZ[1]);
+
+        b = b - upstream;
       } else{
         upstream = xi*zBC\
         *(lZ.col(outUpstreamZ[0])+lZ.col(outUpstreamZ[1]));
@@ -462,7 +554,9 @@ void SimpleCornerBalance::solveAngularFluxPosMu(arma::cube * aFlux,\
   arma::cube * halfAFlux,\
   Eigen::MatrixXd * source,\
   Eigen::MatrixXd * alpha,\
-  int energyGroup,int iXi,int iMu){
+  int energyGroup,int iXi,int iMu,\
+  int zCellBegin,int zCellEnd,\
+  Eigen::VectorXd * inflow){
 
 
   // Index xi, mu, and weight values are stored in quadLevel object
@@ -475,6 +569,10 @@ void SimpleCornerBalance::solveAngularFluxPosMu(arma::cube * aFlux,\
   xi = mesh->quadrature[iXi].quad[0][xiIndex];
   mu = mesh->quadrature[iXi].quad[iMu][muIndex];
 
+  // Sweep the whole axial extent unless given a subdomain
+  if (zCellEnd < 0)
+    zCellEnd = mesh->dzs.size();
+
   // Get neutron velocity in energyGroup 
   double v = materials->neutV(energyGroup);
   int numPs,numQs,reflectedP,reflectedQ,reflectedAngIdx,zStart,rStart,\
@@ -575,8 +673,8 @@ void SimpleCornerBalance::solveAngularFluxPosMu(arma::cube * aFlux,\
   if (xi > 0) {
 
     // Marching from the bottom to the top
-    zStart = 0;
-    zStartCell = 0;
+    zStart = 2*zCellBegin;
+    zStartCell = zCellBegin;
     zInc = 2;
     borderCellZ = -1;
 
@@ -598,8 +696,8 @@ void SimpleCornerBalance::solveAngularFluxPosMu(arma::cube * aFlux,\
   else {			
 
     // Marching from the top to the bottom
-    zStart = mesh->dzsCorner.size()-1;
-    zStartCell = mesh->dzs.size()-1;
+    zStart = 2*zCellEnd-1;
+    zStartCell = zCellEnd-1;
     zInc = -2;
     borderCellZ = 1;
     
@@ -625,7 +723,7 @@ void SimpleCornerBalance::solveAngularFluxPosMu(arma::cube * aFlux,\
    
      
     for (int iZ = zStart, iCellZ = zStartCell,countZ = 0;\
-      countZ < mesh->dzsCorner.size();\
+      countZ < 2*(zCellEnd-zCellBegin);\
       iZ = iZ + zInc, iCellZ = iCellZ + zInc/2,countZ = countZ + 2){
 
       // Set source in each corner
@@ -768,6 +866,16 @@ void SimpleCornerBalance::solveAngularFluxPosMu(arma::cube * aFlux,\
         xi*(*aFlux)(iZ+borderCellZ,iR+cornerOffset(outUpstreamZ[1],0),\
         angIdx)*lZ.col(outUpstreamZ[1]);
 
+        b = b - upstream;
+      } else if (inflow != NULL){
+
+        // Lagged values from the neighbouring subdomain
+        upstream =\
+        xi*(*inflow)(iR+cornerOffset(outUpstreamZ[0],0))\
+        *lZ.col(outUpstreamZ[0])+\
+        xi*(*inflow)(iR+cornerOffset(outUpstreamZ[1],0))\
+        *lZ.col(outUpstreamZ[1]);
+
         b = b - upstream;
       } else{
         upstream = xi*zBC\
@@ -6,6 +6,8 @@
 
 using namespace std; 
 
+class TransportDecomposition; // forward declaration
+
 //==============================================================================
 //! SimpleCornerBalance class that solves RZ neutron transport
 
@@ -22,6 +24,13 @@ class SimpleCornerBalance
     Eigen::MatrixXd * alpha,\
     int energyGroup);
   void solveAngularFlux(arma::cube * aFlux,\
+    arma::cube * halfAFlux,\
+    Eigen::MatrixXd * source,\
+    Eigen::MatrixXd * alpha,\
+    int energyGroup,int iXi,int iMu,\
+    int zCellBegin = 0,int zCellEnd = -1,\
+    Eigen::VectorXd * inflow = NULL);
+  void solveAngularFluxSubdomains(arma::cube * aFlux,\
     arma::cube * halfAFlux,\
     Eigen::MatrixXd * source,\
     Eigen::MatrixXd * alpha,\
@@ -30,15 +39,25 @@ class SimpleCornerBalance
     arma::cube * halfAFlux,\
     Eigen::MatrixXd * source,\
     Eigen::MatrixXd * alpha,\
-    int energyGroup,int iXi,int iMu);
+    int energyGroup,int iXi,int iMu,\
+    int zCellBegin = 0,int zCellEnd = -1,\
+    Eigen::VectorXd * inflow = NULL);
   void solveAngularFluxPosMu(arma::cube * aFlux,\
     arma::cube * halfAFlux,\
     Eigen::MatrixXd * source,\
     Eigen::MatrixXd * alpha,\
-    int energyGroup,int iXi,int iMu);
+    int energyGroup,int iXi,int iMu,\
+    int zCellBegin = 0,int zCellEnd = -1,\
+    Eigen::VectorXd * inflow = NULL);
   
   // default boundary conditions; homogeneous
   vector<double> upperBC,lowerBC,outerBC;
+
+  // Levels owned by other ranks are skipped when set
+  TransportDecomposition * decomposition = NULL;
+
+  // Axial subdomains swept concurrently, each with lagged inflow
+  int nSubdomains = 1;
   Eigen::MatrixXd calckR(double myGamma);
   Eigen::MatrixXd calckZ(double myGamma);
   Eigen::MatrixXd calclR(double myGamma);
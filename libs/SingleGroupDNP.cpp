@@ -6,6 +6,7 @@
 #include "MultiGroupDNP.h"
 #include "MultiPhysicsCoupledQD.h"
 #include "GreyGroupQD.h"
+#include "Scheduler.h"
 
 using namespace std;
 
@@ -99,16 +100,13 @@ SingleGroupDNP::SingleGroupDNP(Materials * myMats,\
 /// @param [in] myA pointer to linear system to build in
 /// @param [in] myb pointer to RHS of linear system
 /// @param [in] myDNPConc DNP concentration at last time step
-/// @param [in] myDNPFlux DNP fluxes for modeling axial advection 
-/// @param [in] myDNPFlux DNP fluxes for modeling axial advection 
-/// @param [in] dzs axial heights on advecting mesh
+/// @param [in] myAdvRate rate of change of DNP concentration due to advection
 /// @param [in] myIndexOffset row to start building linear system on 
 /// @param [in] fluxSource indicator for whether a flux source is present 
 void SingleGroupDNP::buildLinearSystem(Eigen::SparseMatrix<double,Eigen::RowMajor> * myA,\
     Eigen::VectorXd * myb,\
     Eigen::MatrixXd myDNPConc,\
-    Eigen::MatrixXd myDNPFlux,\
-    arma::rowvec dzs,\
+    Eigen::MatrixXd myAdvRate,\
     int myIndexOffset,\
     bool fluxSource)
 {
@@ -123,7 +121,8 @@ void SingleGroupDNP::buildLinearSystem(Eigen::SparseMatrix<double,Eigen::RowMajo
   testMat.resize(nDNPUnknowns,myA->cols());
   testMat.setZero();
   
-  #pragma omp parallel for private(myIndex,iEq,iEqTemp)
+  #pragma omp parallel for private(myIndex,iEq,iEqTemp) \
+    num_threads(mesh->scheduler->threads(Scheduler::assembly))
   for (int iZ = 0; iZ < myDNPConc.rows(); iZ++)
   {
     for (int iR = 0; iR < myDNPConc.cols(); iR++)
@@ -147,7 +146,7 @@ void SingleGroupDNP::buildLinearSystem(Eigen::SparseMatrix<double,Eigen::RowMajo
       }
 
       // Advection term
-      (*myb)(iEq) += (mesh->dt/dzs(iZ))*(myDNPFlux(iZ,iR)-myDNPFlux(iZ+1,iR));
+      (*myb)(iEq) += mesh->dt*myAdvRate(iZ,iR);
 
 
     }
@@ -194,7 +193,8 @@ void SingleGroupDNP::buildSteadyStateLinearSystem(\
 
   if (mats->posVelocity) 
   {
-    #pragma omp parallel for private(myIndex,iEq,iEqTemp)
+    #pragma omp parallel for private(myIndex,iEq,iEqTemp) \
+      num_threads(mesh->scheduler->threads(Scheduler::assembly))
     for (int iZ = 0; iZ < myDNPConc.rows(); iZ++)
     {
       for (int iR = 0; iR < myDNPConc.cols(); iR++)
@@ -231,7 +231,8 @@ void SingleGroupDNP::buildSteadyStateLinearSystem(\
   }
   else
   {
-#pragma omp parallel for private(myIndex,iEq,iEqTemp)
+#pragma omp parallel for private(myIndex,iEq,iEqTemp) \
+  num_threads(mesh->scheduler->threads(Scheduler::assembly))
     for (int iZ = 0; iZ < myDNPConc.rows(); iZ++)
     {
       for (int iR = 0; iR < myDNPConc.cols(); iR++)
@@ -385,13 +386,15 @@ Eigen::MatrixXd SingleGroupDNP::calcDiracs(Eigen::MatrixXd dnpConc,\
 /// @param [in] myInletConc DNP concentration at inlet
 /// @param [in] myInletVelocity velocity at inlet
 /// @param [in] dzs axial heights on advecting mesh
+/// @param [in] advDt time step the advection update is taken over
 /// @param [out] myFlux fluxes used to model precursor advection
 Eigen::MatrixXd SingleGroupDNP::calcFluxes(Eigen::MatrixXd myDNPConc,\
     Eigen::MatrixXd myFlowVelocity,\
     Eigen::MatrixXd myDirac,\
     Eigen::MatrixXd myInletConc,\
     Eigen::VectorXd myInletVelocity,\
-    arma::rowvec dzs)
+    arma::rowvec dzs,\
+    double advDt)
 {
 
   // Declare temporary variables
@@ -410,7 +413,7 @@ Eigen::MatrixXd SingleGroupDNP::calcFluxes(Eigen::MatrixXd myDNPConc,\
       // Handle iZ = 0 case
       vel = myInletVelocity(iR);
       myFlux(0,iR) = vel*myInletConc(1,iR)\
-                     + 0.5*abs(vel)*(1-abs(vel*mesh->dt/dzs(0)))\
+                     + 0.5*abs(vel)*(1-abs(vel*advDt/dzs(0)))\
                      *myDirac(0,iR);
 
       // Handle all other cases
@@ -418,7 +421,7 @@ Eigen::MatrixXd SingleGroupDNP::calcFluxes(Eigen::MatrixXd myDNPConc,\
       {
         vel = myFlowVelocity(iZ-1,iR);
         myFlux(iZ,iR) = vel*myDNPConc(iZ-1,iR)\
-                        + 0.5*abs(vel)*(1-abs(vel*mesh->dt/dzs(iZ-1)))\
+                        + 0.5*abs(vel)*(1-abs(vel*advDt/dzs(iZ-1)))\
                         *myDirac(iZ,iR);
       }
 
@@ -437,7 +440,7 @@ Eigen::MatrixXd SingleGroupDNP::calcFluxes(Eigen::MatrixXd myDNPConc,\
       {
         vel = myFlowVelocity(iZ,iR);
         myFlux(iZ,iR) = vel*myDNPConc(iZ,iR)\
-                        + 0.5*abs(vel)*(1-abs(vel*mesh->dt/dzs(iZ)))\
+                        + 0.5*abs(vel)*(1-abs(vel*advDt/dzs(iZ)))\
                         *myDirac(iZ,iR);
       }
 
@@ -445,7 +448,7 @@ Eigen::MatrixXd SingleGroupDNP::calcFluxes(Eigen::MatrixXd myDNPConc,\
       vel = myInletVelocity(iR);
       myFlux(lastFluxIndex,iR) = vel*myInletConc(0,iR)\
                                  + 0.5*abs(vel)\
-                                 *(1-abs(vel*mesh->dt/dzs(lastFluxIndex-1)))\
+                                 *(1-abs(vel*advDt/dzs(lastFluxIndex-1)))\
                                  *myDirac(lastFluxIndex,iR);
 
     }
@@ -456,6 +459,164 @@ Eigen::MatrixXd SingleGroupDNP::calcFluxes(Eigen::MatrixXd myDNPConc,\
 };
 //==============================================================================
 
+//==============================================================================
+/// Calculate the rates of change of core and recirculation loop DNP 
+/// concentrations due to axial advection
+///
+/// Over a macro step of advMacroSteps time steps, the explicit flux-limited
+/// advection update of the core and recirculation loop is subcycled on 
+/// scratch copies of the concentrations. The core and loop exchange inlet 
+/// and outlet conditions on every subcycle and face fluxes are integrated in
+/// time, so precursors leaving one cell always enter its neighbor. The 
+/// time-averaged rates are reused on each step of the macro step.
+void SingleGroupDNP::calcAdvectionRates()
+{
+
+  Eigen::MatrixXd coreConcSave,recircConcSave,coreIntegral,recircIntegral;
+  Eigen::MatrixXd coreDirac,coreFlux,recircDirac,recircFlux;
+  Eigen::MatrixXd coreIncrement,recircIncrement;
+  double macroDt,subDt;
+  int nSubcycles;
+
+  // Reuse the advection rates if still within the current macro step
+  if (mgdnp->advMacroSteps > 1 and advUpdateState >= 0\
+      and mesh->state >= advUpdateState\
+      and mesh->state - advUpdateState < mgdnp->advMacroSteps\
+      and coreAdvRate.rows() == dnpConc.rows())
+    return;
+
+  macroDt = mgdnp->advMacroSteps*mesh->dt;
+  nSubcycles = calcNumSubcycles(macroDt);
+  subDt = macroDt/nSubcycles;
+
+  coreConcSave = dnpConc;
+  recircConcSave = recircConc;
+  coreIntegral.setZero(dnpConc.rows(),dnpConc.cols());
+  recircIntegral.setZero(recircConc.rows(),recircConc.cols());
+
+  for (int iSub = 0; iSub < nSubcycles; iSub++)
+  {
+    updateBoundaryConditions();
+
+    coreDirac = calcDiracs(dnpConc,\
+        inletConc,\
+        outletConc);
+
+    coreFlux = calcFluxes(dnpConc,\
+        mats->flowVelocity,\
+        coreDirac,\
+        inletConc,\
+        inletVelocity,\
+        mesh->dzsCorner,\
+        subDt);
+
+    coreIncrement = subDt*calcFluxDivergence(coreFlux,mesh->dzsCorner);
+    coreIntegral += coreIncrement;
+
+    // The delay line model sets loop concentrations directly
+    if (not mgdnp->delayLine)
+    {
+      recircDirac = calcDiracs(recircConc,\
+          recircInletConc,\
+          recircOutletConc);
+
+      recircFlux = calcFluxes(recircConc,\
+          mats->recircFlowVelocity,\
+          recircDirac,\
+          recircInletConc,\
+          recircInletVelocity,\
+          mesh->dzsCornerRecirc,\
+          subDt);
+
+      recircIncrement = subDt*calcFluxDivergence(recircFlux,\
+          mesh->dzsCornerRecirc);
+      recircIntegral += recircIncrement;
+    }
+
+    // Advance scratch concentrations for the next subcycle
+    if (nSubcycles > 1)
+    {
+      dnpConc += coreIncrement;
+      if (not mgdnp->delayLine)
+        recircConc += recircIncrement;
+    }
+  }
+
+  // Restore concentrations at the beginning of the step
+  dnpConc = coreConcSave;
+  recircConc = recircConcSave;
+  updateBoundaryConditions();
+
+  coreAdvRate = coreIntegral/macroDt;
+  recircAdvRate = recircIntegral/macroDt;
+  advUpdateState = mesh->state;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate the net advective inflow per unit volume in each cell
+///
+/// @param [in] myDNPFlux DNP fluxes on the axial faces of each cell
+/// @param [in] dzs axial heights on advecting mesh
+/// @param [out] divergence net inflow into each cell
+Eigen::MatrixXd SingleGroupDNP::calcFluxDivergence(Eigen::MatrixXd myDNPFlux,\
+    arma::rowvec dzs)
+{
+
+  Eigen::MatrixXd divergence(myDNPFlux.rows()-1,myDNPFlux.cols());
+
+  for (int iZ = 0; iZ < divergence.rows(); iZ++)
+  {
+    for (int iR = 0; iR < divergence.cols(); iR++)
+    {
+      divergence(iZ,iR) = (myDNPFlux(iZ,iR)-myDNPFlux(iZ+1,iR))/dzs(iZ);
+    }
+  }
+
+  return divergence;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Determine the number of advection subcycles to take over a macro step.
+///   The core and recirculation loop are subcycled together, so the most 
+///   restrictive Courant number of the two sets the count.
+///
+/// @param [in] macroDt length of the macro step
+/// @param [out] nSubcycles number of subcycles to take
+int SingleGroupDNP::calcNumSubcycles(double macroDt)
+{
+
+  double courant,maxCourant = 0.0;
+  int nSubcycles = mgdnp->advSubcycles;
+
+  if (mgdnp->advCourant > 0.0)
+  {
+    for (int iR = 0; iR < mesh->nR; iR++)
+    {
+      for (int iZ = 0; iZ < mesh->nZ; iZ++)
+      {
+        courant = abs(mats->flowVelocity(iZ,iR))*macroDt/mesh->dzsCorner(iZ);
+        maxCourant = max(maxCourant,courant);
+      }
+
+      for (int iZ = 0; iZ < mesh->nZrecirc; iZ++)
+      {
+        courant = abs(mats->recircFlowVelocity(iZ,iR))*macroDt\
+                  /mesh->dzsCornerRecirc(iZ);
+        maxCourant = max(maxCourant,courant);
+      }
+    }
+    nSubcycles = max(nSubcycles,(int) ceil(maxCourant/mgdnp->advCourant));
+  }
+
+  return max(nSubcycles,1);
+
+};
+//==============================================================================
+
 //==============================================================================
 /// Calculate implicit fluxes to model advection of precursors
 ///
@@ -607,9 +768,13 @@ int SingleGroupDNP::setCoreConc()
   PetscErrorCode ierr;
   PetscScalar value;
   PetscInt index;
+  OwnedRows rows;
 
   if (mesh->petsc)
   {
+    // Each rank only adds the entries it owns
+    getOwnedRows(&(mgdnp->mpqd->xPast_p),&rows);
+
     for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
     {
       for (int iZ = 0; iZ < mesh->dzsCorner.size(); iZ++)
@@ -617,7 +782,11 @@ int SingleGroupDNP::setCoreConc()
 
         value = dnpConc(iZ,iR);
         index = getIndex(iZ,iR,coreIndexOffset);
-        ierr = VecSetValue(mgdnp->mpqd->xPast_p,index,value,ADD_VALUES);CHKERRQ(ierr); 
+        if (rows.contains(index))
+        {
+          ierr = VecSetValue(mgdnp->mpqd->xPast_p,index,value,ADD_VALUES);
+          CHKERRQ(ierr);
+        }
 
       }
     }
@@ -708,9 +877,13 @@ int SingleGroupDNP::setRecircConc()
   PetscErrorCode ierr;
   PetscScalar value;
   PetscInt index;
+  OwnedRows rows;
 
   if (mesh->petsc)
   {
+    // Each rank only adds the entries it owns
+    getOwnedRows(&(mgdnp->recircx_p),&rows);
+
     for (int iR = 0; iR < mesh->drsCorner.size(); iR++)
     {
       for (int iZ = 0; iZ < mesh->nZrecirc; iZ++)
@@ -718,7 +891,11 @@ int SingleGroupDNP::setRecircConc()
 
         value = recircConc(iZ,iR);
         index = getIndex(iZ,iR,recircIndexOffset);
-        ierr = VecSetValue(mgdnp->recircx_p,index,value,ADD_VALUES);CHKERRQ(ierr); 
+        if (rows.contains(index))
+        {
+          ierr = VecSetValue(mgdnp->recircx_p,index,value,ADD_VALUES);
+          CHKERRQ(ierr);
+        }
 
       }
     }
@@ -823,7 +1000,8 @@ void SingleGroupDNP::calcRecircDNPFluxes()
       recircDirac,\
       recircInletConc,\
       recircInletVelocity,\
-      mesh->dzsCornerRecirc);
+      mesh->dzsCornerRecirc,\
+      mesh->dt);
 
 };
 //==============================================================================
@@ -845,7 +1023,8 @@ void SingleGroupDNP::calcCoreDNPFluxes()
       coreDirac,\
       inletConc,\
       inletVelocity,\
-      mesh->dzsCorner);
+      mesh->dzsCorner,\
+      mesh->dt);
 
 };
 //==============================================================================
@@ -856,26 +1035,14 @@ void SingleGroupDNP::calcCoreDNPFluxes()
 void SingleGroupDNP::buildCoreLinearSystem()
 {
 
-  Eigen::MatrixXd coreDirac,coreFlux;
-
   updateBoundaryConditions();
 
-  coreDirac = calcDiracs(dnpConc,\
-      inletConc,\
-      outletConc);
-
-  coreFlux = calcFluxes(dnpConc,\
-      mats->flowVelocity,\
-      coreDirac,\
-      inletConc,\
-      inletVelocity,\
-      mesh->dzsCorner);
+  calcAdvectionRates();
 
   buildLinearSystem(&(mgdnp->mpqd->A),\
       &(mgdnp->mpqd->b),\
       dnpConc,\
-      coreFlux,\
-      mesh->dzsCorner,\
+      coreAdvRate,\
       coreIndexOffset);
 };
 //==============================================================================
@@ -912,26 +1079,17 @@ void SingleGroupDNP::buildSteadyStateCoreLinearSystem()
 void SingleGroupDNP::buildRecircLinearSystem()
 {
 
-  Eigen::MatrixXd recircDirac,recircFlux,dumbySigF;
-
   updateBoundaryConditions();
 
-  recircDirac = calcDiracs(recircConc,\
-      recircInletConc,\
-      recircOutletConc);
-
-  recircFlux = calcFluxes(recircConc,\
-      mats->recircFlowVelocity,\
-      recircDirac,\
-      recircInletConc,\
-      recircInletVelocity,\
-      mesh->dzsCornerRecirc);
+  // Advection rates are shared with the core system, which is normally 
+  // built first. Only calculate them here if they do not exist yet.
+  if (recircAdvRate.rows() != recircConc.rows())
+    calcAdvectionRates();
 
   buildLinearSystem(&(mgdnp->recircA),\
       &(mgdnp->recircb),\
       recircConc,\
-      recircFlux,\
-      mesh->dzsCornerRecirc,\
+      recircAdvRate,\
       recircIndexOffset,\
       false);
 
@@ -1051,6 +1209,336 @@ void SingleGroupDNP::updateBoundaryConditions()
 };
 //==============================================================================
 
+/* DELAY LINE RECIRCULATION MODEL */
+
+//==============================================================================
+/// Calculate the time for fluid to travel from the loop inlet to the center
+///   of each cell in the recirculation loop. A column with a stagnant cell 
+///   does not recirculate, and its transit times are left at zero.
+///
+void SingleGroupDNP::calcRecircTransitTimes()
+{
+
+  double vel,upstreamTime;
+  int iZ;
+
+  recircTransitTimes.setZero(mesh->nZrecirc,mesh->nR);
+  recircFlows.assign(mesh->nR,true);
+
+  for (int iR = 0; iR < mesh->nR; iR++)
+  {
+    upstreamTime = 0.0;
+
+    if (mats->recircFlowVelocity.col(iR).cwiseAbs().minCoeff() < 1E-10)
+    {
+      recircFlows[iR] = false;
+      continue;
+    }
+
+    // Walk the loop from its inlet to its outlet
+    for (int iStep = 0; iStep < mesh->nZrecirc; iStep++)
+    {
+      if (mats->posVelocity)
+        iZ = iStep;
+      else
+        iZ = mesh->nZrecirc-1-iStep;
+
+      vel = abs(mats->recircFlowVelocity(iZ,iR));
+      recircTransitTimes(iZ,iR) = upstreamTime\
+                                  + 0.5*mesh->dzsCornerRecirc(iZ)/vel;
+      upstreamTime += mesh->dzsCornerRecirc(iZ)/vel;
+    }
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Longest transit time over the columns that recirculate
+///
+/// @return transit time to the last cell center, or zero if nothing flows
+double SingleGroupDNP::maxRecircTransitTime()
+{
+
+  double maxTransitTime = 0.0;
+
+  for (int iR = 0; iR < mesh->nR; iR++)
+    if (recircFlows[iR])
+      maxTransitTime = max(maxTransitTime,\
+          recircTransitTimes.col(iR).maxCoeff());
+
+  return maxTransitTime;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate DNP concentrations in the recirculation loop assuming plug flow.
+///   Each cell holds fluid that left the core one transit time ago, 
+///   attenuated by decay over that transit time.
+///
+/// @param [in] steadyState indicates whether to use the present core outlet
+///   concentration rather than the outlet history
+void SingleGroupDNP::calcDelayLineRecircConc(bool steadyState)
+{
+
+  double time = mesh->ts[mesh->state],transitTime,emitTime,elapsed;
+
+  calcRecircTransitTimes();
+
+  if (steadyState)
+  {
+    for (int iR = 0; iR < mesh->nR; iR++)
+    {
+      for (int iZ = 0; iZ < mesh->nZrecirc; iZ++)
+      {
+        // Stagnant fluid has decayed away
+        if (not recircFlows[iR])
+        {
+          recircConc(iZ,iR) = 0.0;
+          continue;
+        }
+
+        transitTime = recircTransitTimes(iZ,iR);
+        recircConc(iZ,iR) = dnpConc(recircInletIndex,iR)\
+                            *exp(-lambda*transitTime);
+      }
+    }
+    return;
+  }
+
+  // Start history with the state at the beginning of this time step
+  if (historyCount == 0)
+    resetOutletHistory(time - mesh->dt);
+
+  for (int iR = 0; iR < mesh->nR; iR++)
+  {
+    for (int iZ = 0; iZ < mesh->nZrecirc; iZ++)
+    {
+      transitTime = recircTransitTimes(iZ,iR);
+      emitTime = time - transitTime;
+
+      if (not recircFlows[iR])
+      {
+        // Stagnant fluid only decays in place
+        recircConc(iZ,iR) = recircConcInit(iZ,iR)\
+                            *exp(-lambda*(time - historyStartTime));
+      }
+      else if (emitTime >= historyStartTime)
+      {
+        // Fluid left the core during the recorded history 
+        recircConc(iZ,iR) = interpolateOutletHistory(emitTime,iR)\
+                            *exp(-lambda*transitTime);
+      } 
+      else
+      {
+        // Fluid was already in the loop when the history began
+        elapsed = time - historyStartTime;
+        recircConc(iZ,iR) = interpolateInitialRecircConc(transitTime-elapsed,iR)\
+                            *exp(-lambda*elapsed);
+      }
+    }
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Record the core outlet concentration at the present time. Called once a 
+///   time step has converged.
+///
+void SingleGroupDNP::updateOutletHistory()
+{
+
+  double time = mesh->ts[mesh->state];
+  Eigen::VectorXd coreOutletConc = dnpConc.row(recircInletIndex).transpose();
+
+  calcRecircTransitTimes();
+
+  if (mesh->state == 0 or historyCount == 0)
+    resetOutletHistory(time);
+  else
+    pushOutletHistory(time,coreOutletConc);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Clear the core outlet history and take the present loop concentrations as
+///   the initial condition of the delay line
+///
+/// @param [in] time time at which the history starts
+void SingleGroupDNP::resetOutletHistory(double time)
+{
+
+  Eigen::VectorXd coreOutletConc = dnpConc.row(recircInletIndex).transpose();
+  int capacity;
+
+  // Size buffer to hold about two transit times of history, but never more
+  // entries than there are time steps. The buffer grows if it fills.
+  if (historyTimes.size() == 0)
+  {
+    capacity = 16;
+    if (mesh->dt > 0)
+      capacity = max(capacity,(int) min(ceil(2*maxRecircTransitTime()\
+          /mesh->dt),(double) mesh->dts.size()) + 2);
+    historyTimes.setZero(capacity);
+    outletHistory.setZero(capacity,mesh->nR);
+  }
+
+  recircConcInit = recircConc;
+  recircTransitTimesInit = recircTransitTimes;
+  historyStartTime = time;
+  historyHead = 0;
+  historyCount = 0;
+
+  pushOutletHistory(time,coreOutletConc);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Append a core outlet concentration to the ring buffer holding the outlet
+///   history. Entries older than needed to cover two transit times are 
+///   released.
+///
+/// @param [in] time time of the outlet concentration
+/// @param [in] coreOutletConc concentration leaving the core at each radius
+void SingleGroupDNP::pushOutletHistory(double time,\
+    Eigen::VectorXd coreOutletConc)
+{
+
+  int capacity = historyTimes.size(),iNewest,iEntry;
+  double maxTransitTime = maxRecircTransitTime();
+  Eigen::VectorXd newTimes;
+  Eigen::MatrixXd newHistory;
+
+  // Overwrite newest entry if this time is already recorded
+  if (historyCount > 0)
+  {
+    iNewest = (historyHead + historyCount - 1) % capacity;
+    if (abs(historyTimes(iNewest) - time) <= 1E-12*max(1.0,abs(time)))
+    {
+      outletHistory.row(iNewest) = coreOutletConc.transpose();
+      return;
+    }
+  }
+
+  // Grow buffer if it is full
+  if (historyCount == capacity)
+  {
+    newTimes.setZero(2*capacity);
+    newHistory.setZero(2*capacity,outletHistory.cols());
+    for (int iHist = 0; iHist < historyCount; iHist++)
+    {
+      iEntry = (historyHead + iHist) % capacity;
+      newTimes(iHist) = historyTimes(iEntry);
+      newHistory.row(iHist) = outletHistory.row(iEntry);
+    }
+    historyTimes = newTimes;
+    outletHistory = newHistory;
+    historyHead = 0;
+    capacity = 2*capacity;
+  }
+
+  iEntry = (historyHead + historyCount) % capacity;
+  historyTimes(iEntry) = time;
+  outletHistory.row(iEntry) = coreOutletConc.transpose();
+  historyCount++;
+
+  // Release entries no longer needed for interpolation
+  while (historyCount > 2 and\
+      historyTimes((historyHead + 1) % capacity) < time - 2*maxTransitTime)
+  {
+    historyHead = (historyHead + 1) % capacity;
+    historyCount--;
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Linearly interpolate the core outlet concentration history 
+///
+/// @param [in] time time at which to evaluate the outlet concentration
+/// @param [in] iR radial index
+/// @param [out] conc interpolated outlet concentration
+double SingleGroupDNP::interpolateOutletHistory(double time,int iR)
+{
+
+  int capacity = historyTimes.size(),lower = 0,upper = historyCount-1,middle;
+  int iLower,iUpper;
+  double weight;
+
+  // Clamp to the ends of the recorded history
+  iLower = historyHead;
+  iUpper = (historyHead + historyCount - 1) % capacity;
+  if (time <= historyTimes(iLower))
+    return outletHistory(iLower,iR);
+  if (time >= historyTimes(iUpper))
+    return outletHistory(iUpper,iR);
+
+  // Bisect for the entries bracketing time
+  while (upper - lower > 1)
+  {
+    middle = (lower + upper)/2;
+    if (historyTimes((historyHead + middle) % capacity) <= time)
+      lower = middle;
+    else
+      upper = middle;
+  }
+
+  iLower = (historyHead + lower) % capacity;
+  iUpper = (historyHead + upper) % capacity;
+  weight = (time - historyTimes(iLower))\
+           /(historyTimes(iUpper) - historyTimes(iLower));
+
+  return (1-weight)*outletHistory(iLower,iR) + weight*outletHistory(iUpper,iR);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Linearly interpolate the loop concentration at the start of the history
+///
+/// @param [in] transitTime time since the fluid left the core at the start of
+///   the history
+/// @param [in] iR radial index
+/// @param [out] conc interpolated loop concentration
+double SingleGroupDNP::interpolateInitialRecircConc(double transitTime,int iR)
+{
+
+  int iZ,iZPrev;
+  double weight;
+
+  for (int iStep = 0; iStep < mesh->nZrecirc; iStep++)
+  {
+    if (mats->posVelocity)
+      iZ = iStep;
+    else
+      iZ = mesh->nZrecirc-1-iStep;
+
+    if (transitTime <= recircTransitTimesInit(iZ,iR))
+    {
+      // Fluid lies upstream of the first cell center
+      if (iStep == 0)
+        return recircConcInit(iZ,iR);
+
+      weight = (transitTime - recircTransitTimesInit(iZPrev,iR))\
+               /(recircTransitTimesInit(iZ,iR)\
+               - recircTransitTimesInit(iZPrev,iR));
+      return (1-weight)*recircConcInit(iZPrev,iR)\
+        + weight*recircConcInit(iZ,iR);
+    }
+
+    iZPrev = iZ;
+  }
+
+  return recircConcInit(iZPrev,iR);
+
+};
+//==============================================================================
+
 /* PETSc */
 
 /* STEADY STATE */
@@ -1139,12 +1627,15 @@ int SingleGroupDNP::buildSteadyStateLinearSystem_p(\
   Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> testMat;
   PetscErrorCode ierr;
   PetscScalar value;
+  OwnedRows rows;
 
   //testMat.resize(nDNPUnknowns,myA->cols());
   //testMat.setZero();
   //Atemp.resize(nDNPUnknowns,myA->cols());
   //Atemp.reserve(2*nDNPUnknowns);
 
+  getOwnedRows(A_p,&rows);
+
   if (mats->posVelocity) 
   {
     ////    #pragma omp parallel for private(myIndex,iEq,iEqTemp)
@@ -1157,6 +1648,10 @@ int SingleGroupDNP::buildSteadyStateLinearSystem_p(\
         iEq = getIndex(iZ,iR,myIndexOffset);     
         iEqTemp = getIndex(iZ,iR,0);     
 
+        // Rows owned by other ranks are assembled there
+        if (not rows.contains(iEq))
+          continue;
+
         // DNP decay term
         ierr = MatSetValue(*A_p,iEq,myIndex,lambda,ADD_VALUES);CHKERRQ(ierr); 
         //testMat(iEqTemp,myIndex) = lambda; 
@@ -1207,6 +1702,10 @@ int SingleGroupDNP::buildSteadyStateLinearSystem_p(\
         iEq = getIndex(iZ,iR,myIndexOffset);     
         iEqTemp = getIndex(iZ,iR,0);     
 
+        // Rows owned by other ranks are assembled there
+        if (not rows.contains(iEq))
+          continue;
+
         //testMat(iEqTemp,myIndex) = lambda; 
         ierr = MatSetValue(*A_p,iEq,myIndex,lambda,ADD_VALUES);CHKERRQ(ierr); 
 
@@ -1261,26 +1760,14 @@ int SingleGroupDNP::buildSteadyStateLinearSystem_p(\
 void SingleGroupDNP::buildCoreLinearSystem_p()
 {
 
-  Eigen::MatrixXd coreDirac,coreFlux;
-
   updateBoundaryConditions();
 
-  coreDirac = calcDiracs(dnpConc,\
-      inletConc,\
-      outletConc);
-
-  coreFlux = calcFluxes(dnpConc,\
-      mats->flowVelocity,\
-      coreDirac,\
-      inletConc,\
-      inletVelocity,\
-      mesh->dzsCorner);
+  calcAdvectionRates();
 
   buildLinearSystem_p(&(mgdnp->mpqd->A_p),\
       &(mgdnp->mpqd->b_p),\
       dnpConc,\
-      coreFlux,\
-      mesh->dzsCorner,\
+      coreAdvRate,\
       coreIndexOffset);
 };
 //==============================================================================
@@ -1291,26 +1778,17 @@ void SingleGroupDNP::buildCoreLinearSystem_p()
 void SingleGroupDNP::buildRecircLinearSystem_p()
 {
 
-  Eigen::MatrixXd recircDirac,recircFlux,dumbySigF;
-
   updateBoundaryConditions();
 
-  recircDirac = calcDiracs(recircConc,\
-      recircInletConc,\
-      recircOutletConc);
-
-  recircFlux = calcFluxes(recircConc,\
-      mats->recircFlowVelocity,\
-      recircDirac,\
-      recircInletConc,\
-      recircInletVelocity,\
-      mesh->dzsCornerRecirc);
+  // Advection rates are shared with the core system, which is normally 
+  // built first. Only calculate them here if they do not exist yet.
+  if (recircAdvRate.rows() != recircConc.rows())
+    calcAdvectionRates();
 
   buildLinearSystem_p(&(mgdnp->recircA_p),\
       &(mgdnp->recircb_p),\
       recircConc,\
-      recircFlux,\
-      mesh->dzsCornerRecirc,\
+      recircAdvRate,\
       recircIndexOffset,\
       false);
 
@@ -1324,17 +1802,14 @@ void SingleGroupDNP::buildRecircLinearSystem_p()
 /// @param [in] myA pointer to linear system to build in
 /// @param [in] myb pointer to RHS of linear system
 /// @param [in] myDNPConc DNP concentration at last time step
-/// @param [in] myDNPFlux DNP fluxes for modeling axial advection 
-/// @param [in] myDNPFlux DNP fluxes for modeling axial advection 
-/// @param [in] dzs axial heights on advecting mesh
+/// @param [in] myAdvRate rate of change of DNP concentration due to advection
 /// @param [in] myIndexOffset row to start building linear system on 
 /// @param [in] fluxSource indicator for whether a flux source is present 
 int SingleGroupDNP::buildLinearSystem_p(
     Mat * A_p,\
     Vec * b_p,\
     Eigen::MatrixXd myDNPConc,\
-    Eigen::MatrixXd myDNPFlux,\
-    arma::rowvec dzs,\
+    Eigen::MatrixXd myAdvRate,\
     int myIndexOffset,\
     bool fluxSource)
 {
@@ -1346,6 +1821,9 @@ int SingleGroupDNP::buildLinearSystem_p(
   Eigen::Matrix<double,Eigen::Dynamic,Eigen::Dynamic,Eigen::RowMajor> testMat;
   PetscErrorCode ierr;
   PetscScalar value;
+  OwnedRows rows;
+
+  getOwnedRows(A_p,&rows);
 
   //#pragma omp parallel for private(myIndex,iEq,iEqTemp)
   for (int iZ = 0; iZ < myDNPConc.rows(); iZ++)
@@ -1356,6 +1834,10 @@ int SingleGroupDNP::buildLinearSystem_p(
       iEq = getIndex(iZ,iR,myIndexOffset);     
       iEqTemp = getIndex(iZ,iR,0);     
 
+      // Rows owned by other ranks are assembled there
+      if (not rows.contains(iEq))
+        continue;
+
       value = 1 + mesh->dt*lambda;
       ierr = MatSetValue(*A_p,iEq,myIndex,value,ADD_VALUES);CHKERRQ(ierr); 
       //testMat(iEqTemp,myIndex) = 1 + mesh->dt*lambda; 
@@ -1373,7 +1855,7 @@ int SingleGroupDNP::buildLinearSystem_p(
       }
 
       // Advection term
-      value = (mesh->dt/dzs(iZ))*(myDNPFlux(iZ,iR)-myDNPFlux(iZ+1,iR));
+      value = mesh->dt*myAdvRate(iZ,iR);
       ierr = VecSetValue(*b_p,iEq,value,ADD_VALUES);CHKERRQ(ierr); 
       //(*myb)(iEq) += (mesh->dt/dzs(iZ))*(myDNPFlux(iZ,iR)-myDNPFlux(iZ+1,iR));
 
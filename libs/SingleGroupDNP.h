@@ -18,6 +18,7 @@ class SingleGroupDNP
     Eigen::SparseMatrix<double,Eigen::RowMajor> Atemp;
     Eigen::MatrixXd dnpConc,recircConc,flux,recircFlux,dirac,recircDirac;
     Eigen::MatrixXd inletConc,recircInletConc;
+    Eigen::MatrixXd coreAdvRate,recircAdvRate;
     Eigen::VectorXd inletVelocity,recircInletVelocity,outletConc,recircOutletConc;
     Eigen::VectorXd beta; 
     double lambda;
@@ -26,6 +27,15 @@ class SingleGroupDNP
     int coreIndexOffset = 0;
     int recircIndexOffset = 0;
     int dnpID = 0;
+    int advUpdateState = -1;
+
+    // Delay line model of recirculation loop
+    Eigen::MatrixXd outletHistory,recircConcInit;
+    Eigen::MatrixXd recircTransitTimes,recircTransitTimesInit;
+    vector<bool> recircFlows;
+    Eigen::VectorXd historyTimes;
+    double historyStartTime = 0.0;
+    int historyHead = 0,historyCount = 0;
     SingleGroupDNP(Materials * myMats,\
         Mesh * myMesh,\
         MultiGroupDNP * myMGDNPS,\
@@ -46,8 +56,7 @@ class SingleGroupDNP
     void buildLinearSystem(Eigen::SparseMatrix<double,Eigen::RowMajor> * myA,\
         Eigen::VectorXd * myb,\
         Eigen::MatrixXd myDNPConc,\
-        Eigen::MatrixXd myDNPFlux,\
-        arma::rowvec dzs,\
+        Eigen::MatrixXd myAdvRate,\
         int myIndexOffset,
         bool fluxSource = true);
     void buildSteadyStateLinearSystem(\
@@ -69,7 +78,12 @@ class SingleGroupDNP
         Eigen::MatrixXd dirac,\
         Eigen::MatrixXd inletConc,\
         Eigen::VectorXd inletVelocity,\
+        arma::rowvec dzs,\
+        double advDt);
+    Eigen::MatrixXd calcFluxDivergence(Eigen::MatrixXd myDNPFlux,\
         arma::rowvec dzs);
+    void calcAdvectionRates();
+    int calcNumSubcycles(double macroDt);
     Eigen::MatrixXd calcImplicitFluxes(Eigen::MatrixXd myDNPConc,\
         Eigen::MatrixXd myFlowVelocity,\
         Eigen::MatrixXd inletConc,\
@@ -81,6 +95,14 @@ class SingleGroupDNP
     int setRecircConc();
     double calcPhi(double theta,string fluxLimiter); 
     double calcTheta(double DNPupwindInterface,double DNPinterface);
+    void calcRecircTransitTimes();
+    double maxRecircTransitTime();
+    void calcDelayLineRecircConc(bool steadyState = false);
+    void updateOutletHistory();
+    void resetOutletHistory(double time);
+    void pushOutletHistory(double time,Eigen::VectorXd coreOutletConc);
+    double interpolateOutletHistory(double time,int iR);
+    double interpolateInitialRecircConc(double transitTime,int iR);
 
     /* PETSc functions */   
 
@@ -105,8 +127,7 @@ class SingleGroupDNP
         Mat * A_p,\
         Vec * b_p,\
         Eigen::MatrixXd myDNPConc,\
-        Eigen::MatrixXd myDNPFlux,\
-        arma::rowvec dzs,\
+        Eigen::MatrixXd myAdvRate,\
         int myIndexOffset,\
         bool fluxSource = true);
 
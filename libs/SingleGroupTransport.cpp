@@ -6,6 +6,9 @@
 #include "MultiGroupTransport.h"
 #include "StartingAngle.h"
 #include "SimpleCornerBalance.h"
+#include "TransportDecomposition.h"
+#include "Profiler.h"
+#include "Scheduler.h"
 
 using namespace std; 
 
@@ -38,13 +41,13 @@ SingleGroupTransport::SingleGroupTransport(int myEnergyGroup,\
 
   // Initialize angular fluxes
   aFlux.set_size(mesh->zCornerCent.size(),mesh->rCornerCent.size(),mesh->nAngles);
-  aFlux.zeros();
+  mesh->scheduler->firstTouch(aFlux,Scheduler::moments);
 
   // Initialize half angle angular fluxes used to approximate the angular
   // redistribution term of the RZ neutron transport equation
   aHalfFlux.set_size(mesh->zCornerCent.size(),mesh->rCornerCent.size(),\
       mesh->quadrature.size());
-  aHalfFlux.zeros();
+  mesh->scheduler->firstTouch(aHalfFlux,Scheduler::moments);
 
   // Initialize scalar fluxes
   sFlux.setOnes(mesh->zCornerCent.size(),mesh->rCornerCent.size());
@@ -99,6 +102,10 @@ SingleGroupTransport::SingleGroupTransport(int myEnergyGroup,\
 
 void SingleGroupTransport::solveStartAngle()
 {
+  // Groups swept entirely on other ranks
+  if (not MGT->decomposition->ownsGroup(energyGroup))
+    return;
+
   aHalfFlux.zeros();
   MGT->startAngleSolve->calcStartingAngle(&aHalfFlux,&q,&alpha,energyGroup);
 };
@@ -110,7 +117,16 @@ void SingleGroupTransport::solveStartAngle()
 
 void SingleGroupTransport::solveSCB()
 {
-  aFlux.zeros();  
+  // Groups swept entirely on other ranks
+  if (not MGT->decomposition->ownsGroup(energyGroup))
+    return;
+
+  ScopedTimer timer(mesh->profiler,"sweep");
+  mesh->profiler->count("sweeps");
+
+  // Subdomain sweeps read their inflow from the last sweep's angular flux
+  if (MGT->SCBSolve->nSubdomains == 1)
+    aFlux.zeros();  
   MGT->SCBSolve->solve(&aFlux,&aHalfFlux,&q,&alpha,energyGroup);
 };
 
@@ -353,8 +369,9 @@ double SingleGroupTransport::calcFlux()
   // Set scalar flux to zero
   sFlux.setZero();
 
-  // Calculate scalar flux
+  // Calculate scalar flux over the levels swept on this rank
   for (int iQ = 0; iQ < mesh->quadrature.size(); ++iQ){
+    if (not MGT->decomposition->owns(energyGroup,iQ)) continue;
     for (int iP = 0; iP < mesh->quadrature[iQ].nOrd; ++iP){
 
       weight = mesh->quadrature[iQ].quad[iP][weightIdx];
@@ -371,6 +388,9 @@ double SingleGroupTransport::calcFlux()
     } // iP
   } // iQ
 
+  // Add the contributions of levels swept on other ranks
+  MGT->decomposition->sum({&sFlux});
+
   // Calculate residual
   residual = ((sFlux_old-sFlux).cwiseQuotient(sFlux)).norm();
   return residual;
@@ -0,0 +1,175 @@
+// File: SolutionHistory.cpp     
+// Purpose: Store converged solutions from previous time steps and extrapolate
+//   predictors for the next time step 
+// Date: October 18, 2026
+
+#include "SolutionHistory.h"
+
+using namespace std;
+
+//==============================================================================
+/// SolutionHistory class object constructor
+///
+/// @param [in] myOrder polynomial order of extrapolation 
+/// @param [in] myLength number of past solutions to retain 
+SolutionHistory::SolutionHistory(int myOrder,int myLength)
+{
+
+  setParameters(myOrder,myLength);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Set extrapolation order and history length
+///
+/// @param [in] myOrder polynomial order of extrapolation 
+/// @param [in] myLength number of past solutions to retain 
+void SolutionHistory::setParameters(int myOrder,int myLength)
+{
+
+  order = max(myOrder,0);
+
+  // At least order+1 states are needed to define the polynomial
+  length = max(myLength,order+1);
+
+  while (times.size() > length)
+  {
+    times.pop_front();
+    states.pop_front();
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Store a converged solution, dropping the oldest if history is full
+///
+/// @param [in] time time at which the solution was computed 
+/// @param [in] state converged solution vector 
+void SolutionHistory::push(double time,Eigen::VectorXd state)
+{
+
+  // A time at or before the latest stored time starts a new history 
+  if (times.size() > 0 and time <= times.back())
+  {
+    clear();
+  }
+
+  times.push_back(time);
+  states.push_back(state);
+
+  if (times.size() > length)
+  {
+    times.pop_front();
+    states.pop_front();
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Remove all stored solutions
+///
+void SolutionHistory::clear()
+{
+
+  times.clear();
+  states.clear();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Check whether enough solutions are stored to extrapolate
+///
+bool SolutionHistory::ready()
+{
+
+  return order > 0 and times.size() > order;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Extrapolate stored solutions to a new time
+///
+/// @param [in] time time at which the predictor is wanted 
+/// @return extrapolated solution, or the latest solution if not ready
+Eigen::VectorXd SolutionHistory::extrapolate(double time)
+{
+
+  Eigen::VectorXd weights,predictor;
+
+  if (not ready())
+    return states.back();
+
+  weights = calcWeights(time);
+  predictor.setZero(states.back().size());
+
+  for (int iState = 0; iState < states.size(); iState++)
+  {
+    if (weights(iState) != 0.0)
+      predictor += weights(iState)*states[iState];
+  }
+
+  return predictor;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Calculate weights that map stored solutions to the extrapolated solution.
+///
+/// With exactly order+1 states the weights are the Lagrange basis polynomials
+/// evaluated at time; with more states they are the rows of the least squares
+/// polynomial fit evaluated at time. Times are shifted and scaled by the
+/// history span to keep the normal equations well conditioned.
+///
+/// @param [in] time time at which the predictor is wanted 
+/// @return weight for each stored solution
+Eigen::VectorXd SolutionHistory::calcWeights(double time)
+{
+
+  int nStates = times.size(), nCoeffs = order+1;
+  double scale,s;
+  Eigen::MatrixXd V;
+  Eigen::VectorXd weights,p;
+
+  weights.setZero(nStates);
+
+  if (nStates == nCoeffs)
+  {
+    for (int i = 0; i < nStates; i++)
+    {
+      weights(i) = 1.0;
+      for (int j = 0; j < nStates; j++)
+      {
+        if (j != i)
+          weights(i) *= (time - times[j])/(times[i] - times[j]);
+      }
+    }
+  }
+  else
+  {
+    scale = times.back() - times.front();
+
+    // Vandermonde matrix of stored times and monomials at the new time
+    V.setZero(nStates,nCoeffs);
+    p.setZero(nCoeffs);
+    s = (time - times.back())/scale;
+    for (int iCoeff = 0; iCoeff < nCoeffs; iCoeff++)
+    {
+      p(iCoeff) = pow(s,iCoeff);
+      for (int iState = 0; iState < nStates; iState++)
+        V(iState,iCoeff) = pow((times[iState]-times.back())/scale,iCoeff);
+    }
+
+    // weights = V (V^T V)^{-1} p
+    weights = V*(V.transpose()*V).ldlt().solve(p);
+  }
+
+  return weights;
+
+};
+//==============================================================================
@@ -0,0 +1,37 @@
+#ifndef SOLUTIONHISTORY_H
+#define SOLUTIONHISTORY_H
+
+#include <deque>
+#include <vector>
+#include <cmath>
+#include <iostream>
+#include "../TPLs/eigen-git-mirror/Eigen/Eigen"
+
+using namespace std;
+
+//==============================================================================
+//! Stores recent converged solutions and extrapolates initial guesses
+
+class SolutionHistory
+{
+  public:
+    SolutionHistory(int myOrder = 0,int myLength = 0);
+    
+    // Polynomial order of the extrapolation and number of states retained.
+    // If more states are retained than order+1, a least squares fit is used.
+    int order,length;
+    deque<double> times;
+    deque<Eigen::VectorXd> states;
+    void setParameters(int myOrder,int myLength);
+    void push(double time,Eigen::VectorXd state);
+    void clear();
+    bool ready();
+    Eigen::VectorXd extrapolate(double time);
+    
+  private:
+    Eigen::VectorXd calcWeights(double time);
+};
+
+//==============================================================================
+
+#endif
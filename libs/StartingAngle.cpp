@@ -5,6 +5,7 @@
 // Date: October 28, 2019
 
 #include "StartingAngle.h"
+#include "TransportDecomposition.h"
 
 using namespace std; 
 
@@ -97,6 +98,8 @@ void StartingAngle::calcStartingAngle(arma::cube * halfAFlux,\
 {
 
   for (int iXi = 0; iXi < mesh->quadrature.size(); ++iXi){
+    if (decomposition != NULL and not decomposition->owns(energyGroup,iXi))
+      continue;
     solveAngularFlux(halfAFlux,source,alpha,energyGroup,iXi);
   }
 
@@ -6,6 +6,8 @@
 
 using namespace std; 
 
+class TransportDecomposition; // forward declaration
+
 //==============================================================================
 //! StartingAngle class that solves RZ neutron transport at the starting angles
 
@@ -28,6 +30,9 @@ class StartingAngle
 
     // default boundary conditions; homogeneous
     vector<double> upperBC,lowerBC,outerBC;
+
+    // Levels owned by other ranks are skipped when set
+    TransportDecomposition * decomposition = NULL;
     Eigen::MatrixXd calckR(double myGamma);
     Eigen::MatrixXd calckZ(double myGamma);
     Eigen::MatrixXd calclR(double myGamma);
@@ -0,0 +1,207 @@
+// File: StaticCondensation.cpp
+// Purpose: Eliminate cell-local blocks of unknowns from the QD linear systems
+//   and recover them after the reduced system is solved
+// Date: October 18, 2026
+
+#include "StaticCondensation.h"
+#include "Profiler.h"
+#include "Logger.h"
+
+using namespace std;
+
+//==============================================================================
+/// StaticCondensation class object constructor
+///
+/// @param [in] myMesh mesh object
+/// @param [in] myNUnknowns size of the full system
+/// @param [in] myBlocks indices of the unknowns to eliminate, grouped into
+///   blocks that are coupled only among themselves
+StaticCondensation::StaticCondensation(Mesh * myMesh,int myNUnknowns,\
+  vector< vector<int> > myBlocks)
+{
+
+  mesh = myMesh;
+  nUnknowns = myNUnknowns;
+  blocks = myBlocks;
+
+  keptIndex.assign(nUnknowns,-1);
+  eliminatedIndex.assign(nUnknowns,-1);
+  blockOf.assign(nUnknowns,-1);
+
+  // Eliminated unknowns are numbered block by block
+  for (int iBlock = 0; iBlock < blocks.size(); iBlock++)
+  {
+    blockStart.push_back(eliminated.size());
+    for (int iIndex = 0; iIndex < blocks[iBlock].size(); iIndex++)
+    {
+      eliminatedIndex[blocks[iBlock][iIndex]] = eliminated.size();
+      blockOf[blocks[iBlock][iIndex]] = iBlock;
+      eliminated.push_back(blocks[iBlock][iIndex]);
+    }
+  }
+
+  for (int iUnknown = 0; iUnknown < nUnknowns; iUnknown++)
+  {
+    if (blockOf[iUnknown] != -1) continue;
+    keptIndex[iUnknown] = kept.size();
+    kept.push_back(iUnknown);
+  }
+
+  nKept = kept.size();
+  nEliminated = eliminated.size();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Form the reduced system. The equations of a block are solved for its
+/// unknowns in terms of the kept unknowns, and that solution is substituted
+/// into the remaining equations. A system that cannot be condensed is 
+/// reported once, and condensation is disabled for the rest of the run 
+/// since the structure of the systems does not change between solves.
+///
+/// @param [in] A full system matrix
+/// @param [in] b full right hand side
+/// @return whether every block was invertible and coupled only to itself
+bool StaticCondensation::condense(\
+  const Eigen::SparseMatrix<double,Eigen::RowMajor> & A,\
+  const Eigen::VectorXd & b)
+{
+
+  int iRow,iCol,iBlock;
+  vector<Eigen::Triplet<double>> keptKept,keptElim,elimKept,inverseEntries;
+  vector<Eigen::MatrixXd> blockMatrices(blocks.size());
+  Eigen::SparseMatrix<double,Eigen::RowMajor> couplingKE,couplingEK,\
+    blockInverse,fillIn;
+  Eigen::VectorXd keptB(nKept),elimB(nEliminated);
+
+  if (disabled)
+    return false;
+
+  ScopedTimer timer(mesh->profiler,"condense");
+
+  for (iBlock = 0; iBlock < blocks.size(); iBlock++)
+    blockMatrices[iBlock].setZero(blocks[iBlock].size(),\
+      blocks[iBlock].size());
+
+  // Split the matrix into kept and eliminated parts
+  for (iRow = 0; iRow < A.outerSize(); iRow++)
+  {
+    for (Eigen::SparseMatrix<double,Eigen::RowMajor>::InnerIterator \
+      it(A,iRow); it; ++it)
+    {
+      if (it.value() == 0.0) continue;
+      iCol = it.col();
+      if (blockOf[iRow] == -1 and blockOf[iCol] == -1)
+        keptKept.push_back(Eigen::Triplet<double>(keptIndex[iRow],\
+          keptIndex[iCol],it.value()));
+      else if (blockOf[iRow] == -1)
+        keptElim.push_back(Eigen::Triplet<double>(keptIndex[iRow],\
+          eliminatedIndex[iCol],it.value()));
+      else if (blockOf[iCol] == -1)
+        elimKept.push_back(Eigen::Triplet<double>(eliminatedIndex[iRow],\
+          keptIndex[iCol],it.value()));
+      else if (blockOf[iCol] == blockOf[iRow])
+      {
+        iBlock = blockOf[iRow];
+        blockMatrices[iBlock](eliminatedIndex[iRow] - blockStart[iBlock],\
+          eliminatedIndex[iCol] - blockStart[iBlock]) += it.value();
+      }
+      else
+      {
+        mesh->logger->warning("Condensation") << "Eliminated unknowns " \
+          << iRow << " and " << iCol << " are coupled across blocks; " \
+          << "solving the full systems from now on." << endl;
+        disabled = true;
+        return false;
+      }
+    }
+  }
+
+  // Invert each block
+  for (iBlock = 0; iBlock < blocks.size(); iBlock++)
+  {
+    Eigen::FullPivLU<Eigen::MatrixXd> lu(blockMatrices[iBlock]);
+    if (not lu.isInvertible())
+    {
+      mesh->logger->warning("Condensation") << "Block " << iBlock \
+        << " is singular; solving the full systems from now on." << endl;
+      disabled = true;
+      return false;
+    }
+
+    Eigen::MatrixXd inverse = lu.inverse();
+    for (int iLocal = 0; iLocal < inverse.rows(); iLocal++)
+      for (int jLocal = 0; jLocal < inverse.cols(); jLocal++)
+        inverseEntries.push_back(Eigen::Triplet<double>(blockStart[iBlock]\
+          + iLocal,blockStart[iBlock] + jLocal,inverse(iLocal,jLocal)));
+  }
+
+  reducedA.resize(nKept,nKept);
+  reducedA.setFromTriplets(keptKept.begin(),keptKept.end());
+  couplingKE.resize(nKept,nEliminated);
+  couplingKE.setFromTriplets(keptElim.begin(),keptElim.end());
+  couplingEK.resize(nEliminated,nKept);
+  couplingEK.setFromTriplets(elimKept.begin(),elimKept.end());
+  blockInverse.resize(nEliminated,nEliminated);
+  blockInverse.setFromTriplets(inverseEntries.begin(),inverseEntries.end());
+
+  for (int iKept = 0; iKept < nKept; iKept++)
+    keptB(iKept) = b(kept[iKept]);
+  for (int iElim = 0; iElim < nEliminated; iElim++)
+    elimB(iElim) = b(eliminated[iElim]);
+
+  // x_E = A_EE^-1 (b_E - A_EK x_K), substituted into the kept equations
+  eliminatedCoupling = blockInverse*couplingEK;
+  eliminatedSource = blockInverse*elimB;
+  fillIn = couplingKE*eliminatedCoupling;
+  reducedA = reducedA - fillIn;
+  reducedA.makeCompressed();
+  reducedB = keptB - couplingKE*eliminatedSource;
+
+  mesh->profiler->count("condensedUnknowns",nEliminated);
+
+  return true;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Extract the kept unknowns of a full vector, e.g. an initial guess
+///
+/// @param [in] x vector over the full system
+/// @return vector over the reduced system
+Eigen::VectorXd StaticCondensation::restrictSolution(const Eigen::VectorXd & x)
+{
+
+  Eigen::VectorXd reducedX(nKept);
+
+  for (int iKept = 0; iKept < nKept; iKept++)
+    reducedX(iKept) = x(kept[iKept]);
+
+  return reducedX;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Recover the full solution from the solution of the reduced system
+///
+/// @param [in] reducedX solution of the reduced system
+/// @return solution of the full system
+Eigen::VectorXd StaticCondensation::expandSolution(\
+  const Eigen::VectorXd & reducedX)
+{
+
+  Eigen::VectorXd x(nUnknowns);
+  Eigen::VectorXd elimX = eliminatedSource - eliminatedCoupling*reducedX;
+
+  for (int iKept = 0; iKept < nKept; iKept++)
+    x(kept[iKept]) = reducedX(iKept);
+  for (int iElim = 0; iElim < nEliminated; iElim++)
+    x(eliminated[iElim]) = elimX(iElim);
+
+  return x;
+
+};
+//==============================================================================
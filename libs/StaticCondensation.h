@@ -0,0 +1,41 @@
+#ifndef STATICCONDENSATION_H
+#define STATICCONDENSATION_H
+
+#include "Mesh.h"
+
+using namespace std;
+
+//==============================================================================
+//! Eliminates blocks of unknowns from a sparse linear system whose equations
+///   only couple each block to itself among the eliminated unknowns. In the
+///   QD systems the blocks are the cell center fluxes of one cell, whose
+///   zeroth moment equations share their indices. The reduced system holds
+///   the face fluxes and any other kept unknowns, and the eliminated values
+///   are recovered cell by cell from the reduced solution.
+
+class StaticCondensation
+{
+  public:
+    StaticCondensation(Mesh * myMesh,int myNUnknowns,\
+      vector< vector<int> > myBlocks);
+
+    int nUnknowns,nKept,nEliminated;
+    bool disabled = false;
+    Eigen::SparseMatrix<double,Eigen::RowMajor> reducedA;
+    Eigen::VectorXd reducedB;
+    bool condense(const Eigen::SparseMatrix<double,Eigen::RowMajor> & A,\
+      const Eigen::VectorXd & b);
+    Eigen::VectorXd restrictSolution(const Eigen::VectorXd & x);
+    Eigen::VectorXd expandSolution(const Eigen::VectorXd & reducedX);
+
+  private:
+    Mesh * mesh;
+    vector< vector<int> > blocks;
+    vector<int> keptIndex,eliminatedIndex,blockOf,blockStart,kept,eliminated;
+    Eigen::SparseMatrix<double,Eigen::RowMajor> eliminatedCoupling;
+    Eigen::VectorXd eliminatedSource;
+};
+
+//==============================================================================
+
+#endif
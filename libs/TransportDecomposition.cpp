@@ -0,0 +1,261 @@
+// File: TransportDecomposition.cpp
+// Purpose: Distribute the MGHOT sweeps over MPI ranks by energy group and
+//   quadrature level
+// Date: October 18, 2026
+
+#include <algorithm>
+#include "TransportDecomposition.h"
+#include "Profiler.h"
+#include "Logger.h"
+
+using namespace std;
+
+//==============================================================================
+/// TransportDecomposition class object constructor
+///
+/// @param [in] myMesh mesh object
+/// @param [in] myInput input object
+/// @param [in] myNGroups number of energy groups
+TransportDecomposition::TransportDecomposition(Mesh * myMesh,\
+  YAML::Node * myInput,int myNGroups)
+{
+
+  int initialized = 0;
+
+  mesh = myMesh;
+  input = myInput;
+  nGroups = myNGroups;
+
+  // Transport reductions get their own communicator so they cannot be 
+  // confused with messages from the PETSc solves of the LO systems
+  comm = MPI_COMM_NULL;
+  MPI_Initialized(&initialized);
+  if (initialized)
+  {
+    MPI_Comm_dup(PETSC_COMM_WORLD,&comm);
+    MPI_Comm_rank(comm,&rank);
+    MPI_Comm_size(comm,&nRanks);
+  }
+  nSweepRanks = nRanks;
+
+  checkOptionalParams();
+  assignOwners();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// TransportDecomposition class object destructor
+///
+TransportDecomposition::~TransportDecomposition()
+{
+
+  if (comm != MPI_COMM_NULL)
+    MPI_Comm_free(&comm);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Check whether this rank sweeps a quadrature level of an energy group
+///
+/// @param [in] iGroup energy group
+/// @param [in] iXi quadrature level
+/// @return true if this rank owns the pair
+bool TransportDecomposition::owns(int iGroup,int iXi)
+{
+
+  return owner(iGroup,iXi) == rank;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Check whether this rank sweeps any quadrature level of an energy group
+///
+/// @param [in] iGroup energy group
+/// @return true if this rank owns at least one level of the group
+bool TransportDecomposition::ownsGroup(int iGroup)
+{
+
+  return (owner.row(iGroup).array() == rank).any();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Sum fields over all ranks in place. Each rank passes its partial moments
+///   over the pairs it owns, and every rank receives the full moments. All
+///   fields are combined in a single reduction.
+///
+/// @param [in,out] fields fields to sum, in the same order on every rank
+void TransportDecomposition::sum(vector<Eigen::MatrixXd *> fields)
+{
+
+  int offset = 0;
+
+  if (mode == none or nRanks == 1)
+    return;
+
+  ScopedTimer timer(mesh->profiler,"allreduce");
+
+  for (int iField = 0; iField < fields.size(); iField++)
+    offset += fields[iField]->size();
+  buffer.resize(offset);
+
+  offset = 0;
+  for (int iField = 0; iField < fields.size(); iField++)
+  {
+    Eigen::Map<Eigen::MatrixXd>(buffer.data()+offset,fields[iField]->rows(),\
+      fields[iField]->cols()) = *fields[iField];
+    offset += fields[iField]->size();
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE,buffer.data(),offset,MPI_DOUBLE,MPI_SUM,comm);
+  mesh->profiler->count("allreduceBytes",offset*sizeof(double));
+
+  offset = 0;
+  for (int iField = 0; iField < fields.size(); iField++)
+  {
+    *fields[iField] = Eigen::Map<Eigen::MatrixXd>(buffer.data()+offset,\
+      fields[iField]->rows(),fields[iField]->cols());
+    offset += fields[iField]->size();
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Assemble the full angular fluxes of a group on every rank. Slices of 
+///   levels swept elsewhere hold stale values on this rank, so they are 
+///   cleared before the ranks' contributions are summed.
+///
+/// @param [in] iGroup energy group
+/// @param [in,out] aFlux angular flux indexed by ordinate
+/// @param [in,out] aHalfFlux starting angle flux indexed by level
+void TransportDecomposition::gather(int iGroup,arma::cube * aFlux,\
+  arma::cube * aHalfFlux)
+{
+
+  int angIdx,sliceSize = aFlux->n_rows*aFlux->n_cols;
+
+  if (mode == none or nRanks == 1)
+    return;
+
+  ScopedTimer timer(mesh->profiler,"allreduce");
+
+  for (int iXi = 0; iXi < mesh->quadrature.size(); iXi++)
+  {
+    if (owns(iGroup,iXi)) continue;
+
+    for (int iMu = 0; iMu < mesh->quadrature[iXi].nOrd; iMu++)
+    {
+      angIdx = mesh->quadrature[iXi].ordIdx[iMu];
+      fill(aFlux->memptr() + angIdx*sliceSize,\
+        aFlux->memptr() + (angIdx+1)*sliceSize,0.0);
+    }
+    fill(aHalfFlux->memptr() + iXi*sliceSize,\
+      aHalfFlux->memptr() + (iXi+1)*sliceSize,0.0);
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE,aFlux->memptr(),aFlux->n_elem,MPI_DOUBLE,\
+    MPI_SUM,comm);
+  MPI_Allreduce(MPI_IN_PLACE,aHalfFlux->memptr(),aHalfFlux->n_elem,\
+    MPI_DOUBLE,MPI_SUM,comm);
+  mesh->profiler->count("allreduceBytes",\
+    (aFlux->n_elem + aHalfFlux->n_elem)*sizeof(double));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Assign each (group, level) pair to a rank. Work items are whole groups,
+///   whole levels, or single pairs depending on mode, and are handed out
+///   largest first to the least loaded of the first nSweepRanks ranks. Each
+///   item is weighted by the number of ordinates it sweeps. The assignment 
+///   only depends on the input, so every rank arrives at the same one.
+void TransportDecomposition::assignOwners()
+{
+
+  int nLevels = mesh->quadrature.size(),iOwner;
+  vector<double> load(nSweepRanks,0.0);
+  vector< pair<double,int> > items;
+
+  owner.setConstant(nGroups,nLevels,rank);
+
+  if (mode == none)
+    return;
+
+  // Weight each item by the number of ordinates it sweeps
+  if (mode == groups)
+  {
+    for (int iGroup = 0; iGroup < nGroups; iGroup++)
+      items.push_back(make_pair(mesh->nAngles,iGroup));
+  } else if (mode == levels)
+  {
+    for (int iXi = 0; iXi < nLevels; iXi++)
+      items.push_back(make_pair(nGroups*mesh->quadrature[iXi].nOrd,iXi));
+  } else
+  {
+    for (int iGroup = 0; iGroup < nGroups; iGroup++)
+      for (int iXi = 0; iXi < nLevels; iXi++)
+        items.push_back(make_pair(mesh->quadrature[iXi].nOrd,\
+          iGroup*nLevels + iXi));
+  }
+
+  // Largest items first, ties broken by index so every rank agrees
+  stable_sort(items.begin(),items.end(),\
+    [](const pair<double,int> & a,const pair<double,int> & b)\
+    {return a.first > b.first;});
+
+  for (int iItem = 0; iItem < items.size(); iItem++)
+  {
+    iOwner = min_element(load.begin(),load.end()) - load.begin();
+    load[iOwner] += items[iItem].first;
+
+    if (mode == groups)
+      owner.row(items[iItem].second).setConstant(iOwner);
+    else if (mode == levels)
+      owner.col(items[iItem].second).setConstant(iOwner);
+    else
+      owner(items[iItem].second/nLevels,items[iItem].second%nLevels) = iOwner;
+  }
+
+  mesh->logger->info("MGHOT") << "Sweeps distributed over " << nSweepRanks \
+    << " of " << nRanks << " ranks; largest share " \
+    << *max_element(load.begin(),load.end()) << " of " \
+    << nGroups*mesh->nAngles << " group ordinates." << endl;
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Read decomposition parameters from the input file
+///
+void TransportDecomposition::checkOptionalParams()
+{
+
+  string modeName;
+
+  if ((*input)["parameters"]["mghotDecomposition"])
+  {
+    modeName = (*input)["parameters"]["mghotDecomposition"].as<string>();
+    if (modeName == "groups")
+      mode = groups;
+    else if (modeName == "levels")
+      mode = levels;
+    else if (modeName == "groupsAndLevels")
+      mode = groupsAndLevels;
+    else if (modeName != "none")
+      mesh->logger->warning("MGHOT") << "Unrecognized mghotDecomposition " \
+        << modeName << ", sweeping everything on every rank." << endl;
+  }
+
+  // Sweeps may be confined to the first few ranks, leaving the rest of the
+  // layout to the LO solves
+  if ((*input)["parameters"]["mghotRanks"])
+    nSweepRanks = min(nRanks,\
+      max(1,(*input)["parameters"]["mghotRanks"].as<int>()));
+
+};
+//==============================================================================
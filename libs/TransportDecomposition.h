@@ -0,0 +1,42 @@
+#ifndef TRANSPORTDECOMPOSITION_H
+#define TRANSPORTDECOMPOSITION_H
+
+#include "Mesh.h"
+
+using namespace std;
+
+//==============================================================================
+//! Assigns (energy group, quadrature level) pairs of the MGHOT sweeps to MPI
+///   ranks and sums the angular moments each rank accumulates over the
+///   pairs it owns. Angular fluxes are only assembled on request, e.g. for
+///   checkpoints. Every rank owns every pair when decomposition is none.
+
+class TransportDecomposition
+{
+  public:
+    TransportDecomposition(Mesh * myMesh,YAML::Node * myInput,int myNGroups);
+    ~TransportDecomposition();
+
+    enum Mode {none = 0,groups = 1,levels = 2,groupsAndLevels = 3};
+
+    Mode mode = none;
+    int rank = 0,nRanks = 1,nSweepRanks = 1;
+    Eigen::MatrixXi owner;
+    bool owns(int iGroup,int iXi);
+    bool ownsGroup(int iGroup);
+    void sum(vector<Eigen::MatrixXd *> fields);
+    void gather(int iGroup,arma::cube * aFlux,arma::cube * aHalfFlux);
+    void assignOwners();
+    void checkOptionalParams();
+
+  private:
+    Mesh * mesh;
+    YAML::Node * input;
+    MPI_Comm comm;
+    int nGroups;
+    vector<double> buffer;
+};
+
+//==============================================================================
+
+#endif
@@ -4,6 +4,8 @@
 
 #include "TransportToQDCoupling.h"
 #include "SimpleCornerBalance.h"
+#include "TransportDecomposition.h"
+#include "Scheduler.h"
 
 using namespace std;
 
@@ -29,6 +31,9 @@ TransportToQDCoupling::TransportToQDCoupling(Materials * myMaterials,\
   MGT = myMGT;
   MGQD = myMGQD;
 
+  // Sized once so groups can be updated independently
+  eddingtonResiduals.setZero(MGT->SGTs.size());
+
   // Check for optional parameters
   checkOptionalParams(); 
 
@@ -37,9 +42,12 @@ TransportToQDCoupling::TransportToQDCoupling(Materials * myMaterials,\
 
 //==============================================================================
 /// Calculate Eddington factors using angular fluxes from transport objects
+/// @param [in] groupBegin first energy group to update
+/// @param [in] groupEnd one past the last energy group to update, or -1 for
+///   all groups
 /// @param [out] allConverged boolean indicating if the residual on the 
 /// Eddington factors passes the convergence criteria
-bool TransportToQDCoupling::calcEddingtonFactors()
+bool TransportToQDCoupling::calcEddingtonFactors(int groupBegin,int groupEnd)
 {
   int rows = MGT->SGTs[0]->sFlux.rows();
   int cols = MGT->SGTs[0]->sFlux.cols();
@@ -48,14 +56,21 @@ bool TransportToQDCoupling::calcEddingtonFactors()
   double numeratorEzz,numeratorErr,numeratorErz,denominator;
   double residualZz,residualRr,residualRz;
   bool interfaceConverged,cellAvgConverged=true;
+  Eigen::MatrixXd denominators(rows,cols);
 
-  for (int iGroup = 0; iGroup < MGT->SGTs.size(); iGroup++)
+  if (groupEnd < 0)
+    groupEnd = MGT->SGTs.size();
+
+  for (int iGroup = groupBegin; iGroup < groupEnd; iGroup++)
   {
     // store past eddington factors
     MGQD->SGQDs[iGroup]->EzzPrev = MGQD->SGQDs[iGroup]->Ezz;
     MGQD->SGQDs[iGroup]->ErrPrev = MGQD->SGQDs[iGroup]->Err;
     MGQD->SGQDs[iGroup]->ErzPrev = MGQD->SGQDs[iGroup]->Erz;
 
+    #pragma omp parallel for private(angIdx,angFlux,mu,xi,weight,EzzCoef,\
+      ErrCoef,ErzCoef,numeratorEzz,numeratorErr,numeratorErz,denominator) \
+      num_threads(mesh->scheduler->threads(Scheduler::moments))
     for (int iR = 0; iR < cols; iR++)
     {
       for (int iZ = 0; iZ < rows; iZ++)
@@ -70,6 +85,7 @@ bool TransportToQDCoupling::calcEddingtonFactors()
         // loop over quadrature
         for (int iXi = 0; iXi < mesh->quadrature.size(); ++iXi)
         {
+          if (not MGT->decomposition->owns(iGroup,iXi)) continue;
           xi = mesh->quadrature[iXi].quad[0][xiIdx];
           for (int iMu = 0; iMu < mesh->quadrature[iXi].nOrd; ++iMu)
           {
@@ -91,13 +107,25 @@ bool TransportToQDCoupling::calcEddingtonFactors()
           } //iMu
         } //iXi 
 
-        MGQD->SGQDs[iGroup]->Ezz(iZ,iR) = numeratorEzz/denominator;
-        MGQD->SGQDs[iGroup]->Err(iZ,iR) = numeratorErr/denominator;
-        MGQD->SGQDs[iGroup]->Erz(iZ,iR) = numeratorErz/denominator;
+        // Partial moments until summed over ranks below
+        MGQD->SGQDs[iGroup]->Ezz(iZ,iR) = numeratorEzz;
+        MGQD->SGQDs[iGroup]->Err(iZ,iR) = numeratorErr;
+        MGQD->SGQDs[iGroup]->Erz(iZ,iR) = numeratorErz;
+        denominators(iZ,iR) = denominator;
 
       } //iZ
     } //iR
 
+    MGT->decomposition->sum({&(MGQD->SGQDs[iGroup]->Ezz),\
+        &(MGQD->SGQDs[iGroup]->Err),&(MGQD->SGQDs[iGroup]->Erz),\
+        &denominators});
+    MGQD->SGQDs[iGroup]->Ezz = \
+      MGQD->SGQDs[iGroup]->Ezz.cwiseQuotient(denominators);
+    MGQD->SGQDs[iGroup]->Err = \
+      MGQD->SGQDs[iGroup]->Err.cwiseQuotient(denominators);
+    MGQD->SGQDs[iGroup]->Erz = \
+      MGQD->SGQDs[iGroup]->Erz.cwiseQuotient(denominators);
+
     // measure the residual for each Eddington factors 
     residualZz = ((MGQD->SGQDs[iGroup]->Ezz - MGQD->SGQDs[iGroup]->EzzPrev)\
         .cwiseQuotient(MGQD->SGQDs[iGroup]->Ezz)).norm();
@@ -120,6 +148,8 @@ bool TransportToQDCoupling::calcEddingtonFactors()
    // cout << "residualRz: " << residualRz << endl;
    // cout << endl;
 
+    eddingtonResiduals(iGroup) = max(residualZz,residualRr);
+
     //if (residualZz < epsEddington and residualRr < epsEddington and 
     //    residualRz < epsEddington)
     if (residualZz < epsEddington and residualRr < epsEddington)
@@ -131,13 +161,13 @@ bool TransportToQDCoupling::calcEddingtonFactors()
 
 
   // Calculate interface Eddingtons
-  interfaceConverged = calcInterfaceEddingtonFactors(); 
+  interfaceConverged = calcInterfaceEddingtonFactors(groupBegin,groupEnd); 
 
   // Calculate G used in integrating factor
-  calcGFactors();
+  calcGFactors(groupBegin,groupEnd);
   
   // Calculate g0 and g1 coefficients used in integrating factor 
-  calcIntFactorCoeffs();
+  calcIntFactorCoeffs(groupBegin,groupEnd);
 
 
   return (cellAvgConverged and interfaceConverged);
@@ -147,9 +177,13 @@ bool TransportToQDCoupling::calcEddingtonFactors()
 //==============================================================================
 /// Calculate interfaceEddington factors using angular fluxes from transport 
 ///     objects
+/// @param [in] groupBegin first energy group to update
+/// @param [in] groupEnd one past the last energy group to update, or -1 for
+///   all groups
 /// @param [out] allConverged boolean indicating if the residual on the 
 /// Eddington factors passes the convergence criteria
-bool TransportToQDCoupling::calcInterfaceEddingtonFactors()
+bool TransportToQDCoupling::calcInterfaceEddingtonFactors(int groupBegin,\
+  int groupEnd)
 {
   int rows = MGT->SGTs[0]->sFlux.rows();
   int cols = MGT->SGTs[0]->sFlux.cols();
@@ -159,18 +193,27 @@ bool TransportToQDCoupling::calcInterfaceEddingtonFactors()
   double residualZz,residualRr,residualRz;
   double volLeft,volRight,volUp,volDown;
   bool allConverged=true;
+  Eigen::MatrixXd denominators;
 
   Eigen::MatrixXd ErzAxialPrev,ErrAxialPrev,EzzAxialPrev; 
   Eigen::MatrixXd ErzRadialPrev,ErrRadialPrev,EzzRadialPrev;
 
-  for (int iGroup = 0; iGroup < MGT->SGTs.size(); iGroup++)
+  if (groupEnd < 0)
+    groupEnd = MGT->SGTs.size();
+
+  for (int iGroup = groupBegin; iGroup < groupEnd; iGroup++)
   {
     
     // store past eddington factors
+    denominators.resize(rows,cols+1);
     EzzRadialPrev = MGQD->SGQDs[iGroup]->EzzRadial;
     ErzRadialPrev = MGQD->SGQDs[iGroup]->ErzRadial;
     ErrRadialPrev = MGQD->SGQDs[iGroup]->ErrRadial;
 
+    #pragma omp parallel for private(angIdx,angFlux,mu,xi,weight,EzzCoef,\
+      ErrCoef,ErzCoef,numeratorEzz,numeratorErr,numeratorErz,denominator,\
+      volLeft,volRight) \
+      num_threads(mesh->scheduler->threads(Scheduler::moments))
     for (int iR = 0; iR < cols+1; iR++)
     {
       for (int iZ = 0; iZ < rows; iZ++)
@@ -185,6 +228,7 @@ bool TransportToQDCoupling::calcInterfaceEddingtonFactors()
         // loop over quadrature
         for (int iXi = 0; iXi < mesh->quadrature.size(); ++iXi)
         {
+          if (not MGT->decomposition->owns(iGroup,iXi)) continue;
           xi = mesh->quadrature[iXi].quad[0][xiIdx];
           for (int iMu = 0; iMu < mesh->quadrature[iXi].nOrd; ++iMu)
           {
@@ -217,13 +261,25 @@ bool TransportToQDCoupling::calcInterfaceEddingtonFactors()
           } //iMu
         } //iXi 
 
-        MGQD->SGQDs[iGroup]->EzzRadial(iZ,iR) = numeratorEzz/denominator;
-        MGQD->SGQDs[iGroup]->ErrRadial(iZ,iR) = numeratorErr/denominator;
-        MGQD->SGQDs[iGroup]->ErzRadial(iZ,iR) = numeratorErz/denominator;
+        // Partial moments until summed over ranks below
+        MGQD->SGQDs[iGroup]->EzzRadial(iZ,iR) = numeratorEzz;
+        MGQD->SGQDs[iGroup]->ErrRadial(iZ,iR) = numeratorErr;
+        MGQD->SGQDs[iGroup]->ErzRadial(iZ,iR) = numeratorErz;
+        denominators(iZ,iR) = denominator;
 
       } //iZ
     } //iR
 
+    MGT->decomposition->sum({&(MGQD->SGQDs[iGroup]->EzzRadial),\
+        &(MGQD->SGQDs[iGroup]->ErrRadial),&(MGQD->SGQDs[iGroup]->ErzRadial),\
+        &denominators});
+    MGQD->SGQDs[iGroup]->EzzRadial = \
+      MGQD->SGQDs[iGroup]->EzzRadial.cwiseQuotient(denominators);
+    MGQD->SGQDs[iGroup]->ErrRadial = \
+      MGQD->SGQDs[iGroup]->ErrRadial.cwiseQuotient(denominators);
+    MGQD->SGQDs[iGroup]->ErzRadial = \
+      MGQD->SGQDs[iGroup]->ErzRadial.cwiseQuotient(denominators);
+
     residualZz = calcResidual(EzzRadialPrev, MGQD->SGQDs[iGroup]->EzzRadial);
     residualRr = calcResidual(ErrRadialPrev, MGQD->SGQDs[iGroup]->ErrRadial);
     //residualRz = calcResidual(ErzRadialPrev, MGQD->SGQDs[iGroup]->ErzRadial);
@@ -243,14 +299,19 @@ bool TransportToQDCoupling::calcInterfaceEddingtonFactors()
       allConverged = allConverged and false;
   } //iGroup
 
-  for (int iGroup = 0; iGroup < MGT->SGTs.size(); iGroup++)
+  for (int iGroup = groupBegin; iGroup < groupEnd; iGroup++)
   {
     
     // store past eddington factors
+    denominators.resize(rows+1,cols);
     EzzAxialPrev = MGQD->SGQDs[iGroup]->EzzAxial;
     ErzAxialPrev = MGQD->SGQDs[iGroup]->ErzAxial;
     ErrAxialPrev = MGQD->SGQDs[iGroup]->ErrAxial;
 
+    #pragma omp parallel for private(angIdx,angFlux,mu,xi,weight,EzzCoef,\
+      ErrCoef,ErzCoef,numeratorEzz,numeratorErr,numeratorErz,denominator,\
+      volUp,volDown) \
+      num_threads(mesh->scheduler->threads(Scheduler::moments))
     for (int iR = 0; iR < cols; iR++)
     {
       for (int iZ = 0; iZ < rows+1; iZ++)
@@ -265,6 +326,7 @@ bool TransportToQDCoupling::calcInterfaceEddingtonFactors()
         // loop over quadrature
         for (int iXi = 0; iXi < mesh->quadrature.size(); ++iXi)
         {
+          if (not MGT->decomposition->owns(iGroup,iXi)) continue;
           xi = mesh->quadrature[iXi].quad[0][xiIdx];
           for (int iMu = 0; iMu < mesh->quadrature[iXi].nOrd; ++iMu)
           {
@@ -297,13 +359,25 @@ bool TransportToQDCoupling::calcInterfaceEddingtonFactors()
           } //iMu
         } //iXi 
 
-        MGQD->SGQDs[iGroup]->EzzAxial(iZ,iR) = numeratorEzz/denominator;
-        MGQD->SGQDs[iGroup]->ErrAxial(iZ,iR) = numeratorErr/denominator;
-        MGQD->SGQDs[iGroup]->ErzAxial(iZ,iR) = numeratorErz/denominator;
+        // Partial moments until summed over ranks below
+        MGQD->SGQDs[iGroup]->EzzAxial(iZ,iR) = numeratorEzz;
+        MGQD->SGQDs[iGroup]->ErrAxial(iZ,iR) = numeratorErr;
+        MGQD->SGQDs[iGroup]->ErzAxial(iZ,iR) = numeratorErz;
+        denominators(iZ,iR) = denominator;
 
       } //iZ
     } //iR
 
+    MGT->decomposition->sum({&(MGQD->SGQDs[iGroup]->EzzAxial),\
+        &(MGQD->SGQDs[iGroup]->ErrAxial),&(MGQD->SGQDs[iGroup]->ErzAxial),\
+        &denominators});
+    MGQD->SGQDs[iGroup]->EzzAxial = \
+      MGQD->SGQDs[iGroup]->EzzAxial.cwiseQuotient(denominators);
+    MGQD->SGQDs[iGroup]->ErrAxial = \
+      MGQD->SGQDs[iGroup]->ErrAxial.cwiseQuotient(denominators);
+    MGQD->SGQDs[iGroup]->ErzAxial = \
+      MGQD->SGQDs[iGroup]->ErzAxial.cwiseQuotient(denominators);
+
     // measure the residual for each Eddington factors 
     residualZz = calcResidual(EzzAxialPrev, MGQD->SGQDs[iGroup]->EzzAxial);
     residualRr = calcResidual(ErrAxialPrev, MGQD->SGQDs[iGroup]->ErrAxial);
@@ -331,13 +405,19 @@ bool TransportToQDCoupling::calcInterfaceEddingtonFactors()
 
 //==============================================================================
 /// Calculate G factors using group Eddington factors 
-void TransportToQDCoupling::calcGFactors()
+/// @param [in] groupBegin first energy group to update
+/// @param [in] groupEnd one past the last energy group to update, or -1 for
+///   all groups
+void TransportToQDCoupling::calcGFactors(int groupBegin,int groupEnd)
 {
   int rows = MGT->SGTs[0]->sFlux.rows();
   int cols = MGT->SGTs[0]->sFlux.cols();
   double Ezz, Err;
 
-  for (int iGroup = 0; iGroup < MGT->SGTs.size(); iGroup++)
+  if (groupEnd < 0)
+    groupEnd = MGT->SGTs.size();
+
+  for (int iGroup = groupBegin; iGroup < groupEnd; iGroup++)
   {
     for (int iZ = 0; iZ < rows; iZ++)
     {
@@ -373,14 +453,20 @@ void TransportToQDCoupling::calcGFactors()
 
 //==============================================================================
 /// Calculate integrating factor coefficients
-void TransportToQDCoupling::calcIntFactorCoeffs()
+/// @param [in] groupBegin first energy group to update
+/// @param [in] groupEnd one past the last energy group to update, or -1 for
+///   all groups
+void TransportToQDCoupling::calcIntFactorCoeffs(int groupBegin,int groupEnd)
 {
   int rows = MGT->SGTs[0]->sFlux.rows();
   double g0, g1, Gcell, Gedge, p;
 
   double rAvg = mesh->rVWCornerCent[0], rUp = mesh->rCornerEdge[1];
 
-  for (int iGroup = 0; iGroup < MGT->SGTs.size(); iGroup++)
+  if (groupEnd < 0)
+    groupEnd = MGT->SGTs.size();
+
+  for (int iGroup = groupBegin; iGroup < groupEnd; iGroup++)
   {
     for (int iZ = 0; iZ < rows; iZ++)
     {
@@ -406,7 +492,10 @@ void TransportToQDCoupling::calcIntFactorCoeffs()
 //==============================================================================
 /// Calculate a number a parameters used for forming the boundary conditions of
 /// low order problem 
-void TransportToQDCoupling::calcBCs()
+/// @param [in] groupBegin first energy group to update
+/// @param [in] groupEnd one past the last energy group to update, or -1 for
+///   all groups
+void TransportToQDCoupling::calcBCs(int groupBegin,int groupEnd)
 {
   int rows = MGT->SGTs[0]->sFlux.rows();
   int cols = MGT->SGTs[0]->sFlux.cols();
@@ -419,7 +508,14 @@ void TransportToQDCoupling::calcBCs()
   double outwardFluxE,outwardFluxN,outwardFluxS;
   double localScalarFluxE, localScalarFluxN, localScalarFluxS;
 
-  for (int iGroup = 0; iGroup < MGT->SGTs.size(); iGroup++)
+  // Partial currents and fluxes on each boundary face, kept so the levels 
+  // swept on other ranks can be added in before ratios are taken
+  Eigen::MatrixXd eMoments(rows,5),nsMoments(cols,10);
+
+  if (groupEnd < 0)
+    groupEnd = MGT->SGTs.size();
+
+  for (int iGroup = groupBegin; iGroup < groupEnd; iGroup++)
   {
     for (int iZ = 0; iZ < rows; iZ++)
     {
@@ -433,6 +529,7 @@ void TransportToQDCoupling::calcBCs()
       // loop over quadrature
       for (int iXi = 0; iXi < mesh->quadrature.size(); ++iXi)
       {
+        if (not MGT->decomposition->owns(iGroup,iXi)) continue;
         xi = mesh->quadrature[iXi].quad[0][xiIdx];
         for (int iMu = 0; iMu < mesh->quadrature[iXi].nOrd; ++iMu)
         {
@@ -468,6 +565,21 @@ void TransportToQDCoupling::calcBCs()
         } //iMu
       } //iXi 
 
+      eMoments.row(iZ) << inwardJrE,inwardFluxE,outwardJrE,outwardFluxE,\
+        localScalarFluxE;
+
+    } //iZ
+
+    MGT->decomposition->sum({&eMoments});
+
+    for (int iZ = 0; iZ < rows; iZ++)
+    {
+      inwardJrE = eMoments(iZ,0);
+      inwardFluxE = eMoments(iZ,1);
+      outwardJrE = eMoments(iZ,2);
+      outwardFluxE = eMoments(iZ,3);
+      localScalarFluxE = eMoments(iZ,4);
+
       // set inward current in SGQD object 
       MGQD->SGQDs[iGroup]->eInwardCurrentBC(iZ) = inwardJrE;
 
@@ -504,6 +616,7 @@ void TransportToQDCoupling::calcBCs()
       // loop over quadrature
       for (int iXi = 0; iXi < mesh->quadrature.size(); ++iXi)
       {
+        if (not MGT->decomposition->owns(iGroup,iXi)) continue;
         xi = mesh->quadrature[iXi].quad[0][xiIdx];
         for (int iMu = 0; iMu < mesh->quadrature[iXi].nOrd; ++iMu)
         {
@@ -551,6 +664,27 @@ void TransportToQDCoupling::calcBCs()
         } //iMu
       } //iXi 
 
+      nsMoments.row(iR) << inwardJzN,inwardFluxN,outwardJzN,outwardFluxN,\
+        localScalarFluxN,inwardJzS,inwardFluxS,outwardJzS,outwardFluxS,\
+        localScalarFluxS;
+
+    } //iR 
+
+    MGT->decomposition->sum({&nsMoments});
+
+    for (int iR = 0; iR < cols; iR++)
+    {
+      inwardJzN = nsMoments(iR,0);
+      inwardFluxN = nsMoments(iR,1);
+      outwardJzN = nsMoments(iR,2);
+      outwardFluxN = nsMoments(iR,3);
+      localScalarFluxN = nsMoments(iR,4);
+      inwardJzS = nsMoments(iR,5);
+      inwardFluxS = nsMoments(iR,6);
+      outwardJzS = nsMoments(iR,7);
+      outwardFluxS = nsMoments(iR,8);
+      localScalarFluxS = nsMoments(iR,9);
+
       // set inward current in SGQD object 
       MGQD->SGQDs[iGroup]->nInwardCurrentBC(iR) = inwardJzN;
       MGQD->SGQDs[iGroup]->sInwardCurrentBC(iR) = inwardJzS;
@@ -598,6 +732,8 @@ void TransportToQDCoupling::solveTransportWithQDAcceleration()
   // loop over time steps
   for (int iTime = 0; iTime < mesh->dts.size(); iTime++)
   {
+    // Every group sees a new time step 
+    MGT->activateAllGroups();
 
     MGQD->buildLinearSystem();
     MGQD->solveLinearSystem();
@@ -24,17 +24,20 @@ class TransportToQDCoupling
     YAML::Node * myInput,\
     MultiGroupTransport * myMGT,\
     MultiGroupQD * myMGQD);
-  bool calcEddingtonFactors();
-  bool calcInterfaceEddingtonFactors();
-  void calcGFactors();
-  void calcIntFactorCoeffs();
-  void calcBCs();
+  bool calcEddingtonFactors(int groupBegin = 0,int groupEnd = -1);
+  bool calcInterfaceEddingtonFactors(int groupBegin = 0,int groupEnd = -1);
+  void calcGFactors(int groupBegin = 0,int groupEnd = -1);
+  void calcIntFactorCoeffs(int groupBegin = 0,int groupEnd = -1);
+  void calcBCs(int groupBegin = 0,int groupEnd = -1);
   void solveTransportWithQDAcceleration();
   double calcResidual(Eigen::MatrixXd matrix1,Eigen::MatrixXd matrix2);
   void updateTransportFluxes();
   void updateTransportPrevFluxes();
   void checkOptionalParams();
   double epsEddington = 1.0E-5;
+  // Largest cell-averaged Eddington factor residual in each group from the
+  // last call to calcEddingtonFactors
+  Eigen::VectorXd eddingtonResiduals;
 
 
   private:
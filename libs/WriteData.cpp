@@ -4,6 +4,8 @@
 
 #include "Mesh.h"
 #include "WriteData.h"
+#include "Profiler.h"
+#include "Logger.h"
 
 using namespace std; 
 
@@ -17,11 +19,29 @@ const static Eigen::IOFormat CSVFormat(Eigen::FullPrecision,\
 /// @param [in] nR number of radial cells
 WriteData::WriteData(Mesh * myMesh, string myInputDir)
 {
+  int initialized = 0;
+
   // assign pointers
   mesh = myMesh;
   
   // Set output root directory 
   outputDirectory = myInputDir;    
+
+  // Every rank holds the full solution, so only rank 0 writes it
+  MPI_Initialized(&initialized);
+  if (initialized)
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+};
+//==============================================================================
+
+//==============================================================================
+/// WriteData class object destructor. Writes any queued output first.
+///
+WriteData::~WriteData()
+{
+
+  finish();
+
 };
 //==============================================================================
 
@@ -31,9 +51,31 @@ WriteData::WriteData(Mesh * myMesh, string myInputDir)
 /// @param [in] dirName relative path of directory to be made 
 void WriteData::makeDirectory(string myDirName,bool noTimeLabel)
 {
+
+  if (rank != 0)
+    return;
  
   // Get time at present state
   string dir = getOutputPath(myDirName,noTimeLabel); 
+
+  makePath(dir);
+
+};
+//===============================================================================
+
+//==============================================================================
+/// Issue a system command to make a directory, the first time it is requested.
+/// Safe to call from the writer thread and from other objects at once.
+///
+/// @param [in] dir path of directory to be made 
+void WriteData::makePath(string dir)
+{
+
+  lock_guard<mutex> lock(pathMutex);
+
+  if (madeDirectories.count(dir) > 0)
+    return;
+  madeDirectories.insert(dir);
  
   // Parse system command
   string command = "mkdir -p " + dir;  
@@ -52,22 +94,13 @@ void WriteData::makeDirectory(string myDirName,bool noTimeLabel)
 /// @param [in] myData data to write
 void WriteData::write(string myDirName,\
     string parameterName,\
-    Eigen::MatrixXd myData,\
+    const Eigen::MatrixXd & myData,\
     bool noTimeLabel)
 {
 
-  // Declare output stream.
-  ofstream outputFile;
-
-  // Form directory and file names, and create directory. 
-  makeDirectory(myDirName,noTimeLabel);
-  string dir = getOutputPath(myDirName,noTimeLabel);
-  string fileName = dir + parameterName + ".csv";
-   
-  // Open output file, write myData to it, and close.
-  outputFile.open(fileName);
-  outputFile << myData.format(CSVFormat) << endl;
-  outputFile.close();
+  OutputRecord * record = newRecord(myDirName,parameterName,0,noTimeLabel);
+  record->doubleData = myData;
+  submit(record);
  
 };
 //==============================================================================
@@ -80,22 +113,13 @@ void WriteData::write(string myDirName,\
 /// @param [in] myData data to write
 void WriteData::write(string myDirName,\
     string parameterName,\
-    Eigen::VectorXd myData,\
+    const Eigen::VectorXd & myData,\
     bool noTimeLabel)
 {
 
-  // Declare output stream.
-  ofstream outputFile;
-
-  // Form directory and file names. 
-  makeDirectory(myDirName,noTimeLabel);
-  string dir = getOutputPath(myDirName,noTimeLabel);
-  string fileName = dir + parameterName + ".csv";
-  
-  // Open output file, write myData to it, and close.
-  outputFile.open(fileName);
-  outputFile << myData.format(CSVFormat) << endl;
-  outputFile.close();
+  OutputRecord * record = newRecord(myDirName,parameterName,0,noTimeLabel);
+  record->doubleData = myData;
+  submit(record);
  
 };
 //==============================================================================
@@ -108,22 +132,13 @@ void WriteData::write(string myDirName,\
 /// @param [in] myData data to write
 void WriteData::write(string myDirName,\
     string parameterName,\
-    Eigen::VectorXi myData,\
+    const Eigen::VectorXi & myData,\
     bool noTimeLabel)
 {
 
-  // Declare output stream.
-  ofstream outputFile;
-
-  // Form directory and file names. 
-  makeDirectory(myDirName,noTimeLabel);
-  string dir = getOutputPath(myDirName,noTimeLabel);
-  string fileName = dir + parameterName + ".csv";
-  
-  // Open output file, write myData to it, and close.
-  outputFile.open(fileName);
-  outputFile << myData.format(CSVFormat) << endl;
-  outputFile.close();
+  OutputRecord * record = newRecord(myDirName,parameterName,1,noTimeLabel);
+  record->intData = myData;
+  submit(record);
  
 };
 //==============================================================================
@@ -136,21 +151,20 @@ void WriteData::write(string myDirName,\
 /// @param [in] myData data to write
 void WriteData::write(string myDirName,\
     string parameterName,\
-    vector<double> myData,\
+    const vector<double> & myData,\
     bool noTimeLabel)
 {
 
-  // Declare output stream.
-  Eigen::VectorXd convertedData;
+  OutputRecord * record = newRecord(myDirName,parameterName,0,noTimeLabel);
 
-  // Read std::vector data into an Eigen::VectorXd 
-  convertedData.setZero(myData.size());
-  for (int iElem = 0; iElem < convertedData.size(); iElem++)
+  // Read std::vector data into the record's buffer 
+  record->doubleData.resize(myData.size(),1);
+  for (int iElem = 0; iElem < myData.size(); iElem++)
   {
-    convertedData(iElem) = myData[iElem];
+    record->doubleData(iElem) = myData[iElem];
   }
 
-  write(myDirName,parameterName,convertedData,noTimeLabel);
+  submit(record);
 
 };
 //==============================================================================
@@ -163,21 +177,20 @@ void WriteData::write(string myDirName,\
 /// @param [in] myData data to write
 void WriteData::write(string myDirName,\
     string parameterName,\
-    vector<int> myData,\
+    const vector<int> & myData,\
     bool noTimeLabel)
 {
 
-  // Declare output stream.
-  Eigen::VectorXi convertedData;
+  OutputRecord * record = newRecord(myDirName,parameterName,1,noTimeLabel);
 
-  // Read std::vector data into an Eigen::VectorXd 
-  convertedData.setZero(myData.size());
-  for (int iElem = 0; iElem < convertedData.size(); iElem++)
+  // Read std::vector data into the record's buffer 
+  record->intData.resize(myData.size(),1);
+  for (int iElem = 0; iElem < myData.size(); iElem++)
   {
-    convertedData(iElem) = myData[iElem];
+    record->intData(iElem) = myData[iElem];
   }
 
-  write(myDirName,parameterName,convertedData,noTimeLabel);
+  submit(record);
 
 };
 //==============================================================================
@@ -195,18 +208,9 @@ void WriteData::write(string myDirName,\
     bool noTimeLabel)
 {
 
-  // Declare output stream.
-  ofstream outputFile;
-
-  // Form directory and file names. 
-  makeDirectory(myDirName,noTimeLabel);
-  string dir = getOutputPath(myDirName,noTimeLabel);
-  string fileName = dir + parameterName + ".csv";
-  
-  // Open output file, write myData to it, and close.
-  outputFile.open(fileName);
-  outputFile << setprecision(17) << myData << endl;
-  outputFile.close();
+  OutputRecord * record = newRecord(myDirName,parameterName,2,noTimeLabel);
+  record->doubleData.setConstant(1,1,myData);
+  submit(record);
  
 };
 //==============================================================================
@@ -223,18 +227,9 @@ void WriteData::write(string myDirName,\
     bool noTimeLabel)
 {
 
-  // Declare output stream.
-  ofstream outputFile;
-
-  // Form directory and file names. 
-  makeDirectory(myDirName,noTimeLabel);
-  string dir = getOutputPath(myDirName,noTimeLabel);
-  string fileName = dir + parameterName + ".csv";
-  
-  // Open output file, write myData to it, and close.
-  outputFile.open(fileName);
-  outputFile << myData << endl;
-  outputFile.close();
+  OutputRecord * record = newRecord(myDirName,parameterName,3,noTimeLabel);
+  record->intData.setConstant(1,1,myData);
+  submit(record);
  
 };
 //==============================================================================
@@ -264,4 +259,382 @@ string WriteData::getOutputPath(string myDirName, bool noTimeLabel)
 };
 //===============================================================================
 
+//==============================================================================
+/// Select output backends
+///
+/// @param [in] format "csv", "binary", or "both" 
+void WriteData::setFormat(string format)
+{
+
+  if (format == "binary")
+  {
+    writeCSV = false;
+    writeBinary = true;
+  }
+  else if (format == "both")
+  {
+    writeCSV = true;
+    writeBinary = true;
+  }
+  else if (format == "csv")
+  {
+    writeCSV = true;
+    writeBinary = false;
+  }
+  else
+  {
+    mesh->logger->warning("Output") << "Output format " << format \
+      << " not recognized. Using csv." << endl;
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Turn asynchronous output on or off. Turning it off writes everything that 
+/// is queued before returning.
+///
+/// @param [in] myAsync whether output should be written by a background thread
+/// @param [in] myQueueSize maximum number of pending records
+void WriteData::setAsync(bool myAsync,int myQueueSize)
+{
+
+  finish();
+
+  async = myAsync;
+  queueSize = max(myQueueSize,1);
+
+  if (async)
+  {
+    stopWriter = false;
+    writerThread = thread(&WriteData::writerLoop,this);
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Block until every queued record has been written and flushed to disk
+///
+void WriteData::drain()
+{
+
+  unique_lock<mutex> lock(queueMutex);
+  queueNotFull.wait(lock,[this]{return pending.empty() and not writing;});
+  flushBinaryFiles();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write every queued record, stop the writer thread, and flush the binary
+/// output to disk
+///
+void WriteData::finish()
+{
+
+  if (writerThread.joinable())
+  {
+    {
+      lock_guard<mutex> lock(queueMutex);
+      stopWriter = true;
+    }
+    queueNotEmpty.notify_all();
+    writerThread.join();
+  }
+
+  flushBinaryFiles();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Mark the end of a time step. The binary output is flushed once the 
+/// records of the step are written, so it is readable if the run is 
+/// interrupted. The flush is queued behind those records when output is
+/// asynchronous.
+///
+void WriteData::endStep()
+{
+
+  if (not writeBinary or rank != 0)
+    return;
+
+  submit(newRecord("","",4,true));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Flush the binary output and index files
+///
+void WriteData::flushBinaryFiles()
+{
+
+  if (not binaryFile.is_open())
+    return;
+
+  binaryFile.flush();
+  indexFile.flush();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Get a record to hold a write, reusing a written record when available.
+/// The output path and time are resolved now since the mesh state may have 
+/// advanced by the time the record is written.
+///
+/// @param [in] myDirName relative path of directory to be made 
+/// @param [in] parameterName label for variable being written
+/// @param [in] dataType 0 double matrix, 1 int matrix, 2 double, 3 int, 
+///   4 flush of the binary output
+/// @param [in] noTimeLabel whether the data is independent of time
+WriteData::OutputRecord * WriteData::newRecord(string myDirName,\
+    string parameterName,\
+    int dataType,\
+    bool noTimeLabel)
+{
+
+  OutputRecord * record = NULL;
+
+  {
+    lock_guard<mutex> lock(queueMutex);
+    if (not freeRecords.empty())
+    {
+      record = freeRecords.back();
+      freeRecords.pop_back();
+    }
+  }
+
+  if (record == NULL)
+    record = new OutputRecord;
+
+  record->dir = getOutputPath(myDirName,noTimeLabel);
+  record->name = myDirName + parameterName;
+  record->parameterName = parameterName;
+  record->noTimeLabel = noTimeLabel;
+  record->dataType = dataType;
+  record->time = noTimeLabel ? 0.0 : mesh->ts[mesh->state];
+
+  return record;
+
+};
+//==============================================================================
 
+//==============================================================================
+/// Write a record now, or queue it for the writer thread. If the queue is 
+/// full, wait for the writer to catch up.
+///
+/// @param [in] record record to write
+void WriteData::submit(OutputRecord * record)
+{
+
+  // Records on ranks other than 0 are discarded
+  if (not async or rank != 0)
+  {
+    if (rank == 0)
+      writeRecord(record);
+    lock_guard<mutex> lock(queueMutex);
+    freeRecords.push_back(record);
+    return;
+  }
+
+  {
+    unique_lock<mutex> lock(queueMutex);
+    queueNotFull.wait(lock,[this]{return pending.size() < queueSize;});
+    pending.push_back(record);
+  }
+  queueNotEmpty.notify_one();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Body of the writer thread. Writes queued records in order until finish 
+/// is called and the queue is empty.
+///
+void WriteData::writerLoop()
+{
+
+  OutputRecord * record;
+
+  while (true)
+  {
+    {
+      unique_lock<mutex> lock(queueMutex);
+      queueNotEmpty.wait(lock,[this]{return stopWriter or not pending.empty();});
+      if (pending.empty())
+        return;
+      record = pending.front();
+      pending.pop_front();
+      writing = true;
+    }
+
+    writeRecord(record);
+
+    {
+      lock_guard<mutex> lock(queueMutex);
+      freeRecords.push_back(record);
+      writing = false;
+    }
+    queueNotFull.notify_all();
+  }
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write a record to the enabled backends
+///
+/// @param [in] record record to write
+void WriteData::writeRecord(OutputRecord * record)
+{
+
+  // Declare output stream.
+  ofstream outputFile;
+
+  if (record->dataType == 4)
+  {
+    flushBinaryFiles();
+    return;
+  }
+
+  // Append to binary output 
+  if (writeBinary)
+    writeBinaryRecord(record);
+
+  if (not writeCSV)
+    return;
+
+  // Form directory and file names, and create directory. 
+  makePath(record->dir);
+  string fileName = record->dir + record->parameterName + ".csv";
+   
+  // Open output file, write data to it, and close.
+  outputFile.open(fileName);
+  if (record->dataType == 0)
+    outputFile << record->doubleData.format(CSVFormat) << endl;
+  else if (record->dataType == 1)
+    outputFile << record->intData.format(CSVFormat) << endl;
+  else if (record->dataType == 2)
+    outputFile << setprecision(17) << record->doubleData(0) << endl;
+  else
+    outputFile << record->intData(0) << endl;
+  mesh->profiler->count("bytesWritten",outputFile.tellp());
+  outputFile.close();
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Open the binary output and index files for this run and write their 
+/// headers. Each file starts with an 8 character tag and the integer 1, which
+/// readers use to check the byte order. A restarted run appends to the files
+/// of the run it continues and keeps their headers.
+///
+void WriteData::openBinaryFiles()
+{
+
+  int byteOrder = 1;
+  string binaryPath = outputDirectory + binaryFileName;
+  string indexPath = outputDirectory + indexFileName;
+
+  if (binaryFile.is_open())
+    return;
+
+  makeDirectory("",true);
+
+  if (restarting and ifstream(binaryPath).good() \
+      and ifstream(indexPath).good())
+  {
+    binaryFile.open(binaryPath,ios::out | ios::binary | ios::app | ios::ate);
+    indexFile.open(indexPath,ios::out | ios::binary | ios::app | ios::ate);
+    return;
+  }
+
+  binaryFile.open(binaryPath,ios::out | ios::binary | ios::trunc);
+  binaryFile.write("QMOUT001",8);
+  binaryFile.write(reinterpret_cast<const char*>(&byteOrder),sizeof(int));
+
+  indexFile.open(indexPath,ios::out | ios::binary | ios::trunc);
+  indexFile.write("QMIDX001",8);
+  indexFile.write(reinterpret_cast<const char*>(&byteOrder),sizeof(int));
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Write the header of a binary record and its index entry.
+///
+/// A record is the tag "QREC", the number of bytes that follow, the data type 
+/// (0 for double, 1 for int), whether the record is time labeled, the time, 
+/// the number of rows and columns, the length of the name and the name, 
+/// followed by the data in column-major order. An index entry holds the time,
+/// the time label flag, the offset of the record, the name length and the 
+/// name.
+///
+/// @param [in] record record being written
+/// @param [in] dataType 0 for double, 1 for int
+/// @param [in] rows number of rows in data
+/// @param [in] cols number of columns in data
+void WriteData::writeRecordHeader(OutputRecord * record,\
+    int dataType,\
+    int rows,\
+    int cols)
+{
+
+  int nameLength = record->name.size(), hasTime = not record->noTimeLabel;
+  int dataSize = (dataType == 0) ? sizeof(double) : sizeof(int);
+  int recordLength = 5*sizeof(int) + sizeof(double) + nameLength\
+                     + rows*cols*dataSize;
+  double time = record->time;
+  long long offset;
+
+  openBinaryFiles();
+  offset = binaryFile.tellp();
+  mesh->profiler->count("bytesWritten",4 + sizeof(int) + recordLength);
+
+  binaryFile.write("QREC",4);
+  binaryFile.write(reinterpret_cast<const char*>(&recordLength),sizeof(int));
+  binaryFile.write(reinterpret_cast<const char*>(&dataType),sizeof(int));
+  binaryFile.write(reinterpret_cast<const char*>(&hasTime),sizeof(int));
+  binaryFile.write(reinterpret_cast<const char*>(&time),sizeof(double));
+  binaryFile.write(reinterpret_cast<const char*>(&rows),sizeof(int));
+  binaryFile.write(reinterpret_cast<const char*>(&cols),sizeof(int));
+  binaryFile.write(reinterpret_cast<const char*>(&nameLength),sizeof(int));
+  binaryFile.write(record->name.c_str(),nameLength);
+
+  indexFile.write(reinterpret_cast<const char*>(&time),sizeof(double));
+  indexFile.write(reinterpret_cast<const char*>(&hasTime),sizeof(int));
+  indexFile.write(reinterpret_cast<const char*>(&offset),sizeof(long long));
+  indexFile.write(reinterpret_cast<const char*>(&nameLength),sizeof(int));
+  indexFile.write(record->name.c_str(),nameLength);
+
+};
+//==============================================================================
+
+//==============================================================================
+/// Append a record to the binary output file
+///
+/// @param [in] record record to write
+void WriteData::writeBinaryRecord(OutputRecord * record)
+{
+
+  if (record->dataType == 0 or record->dataType == 2)
+  {
+    writeRecordHeader(record,0,record->doubleData.rows(),\
+        record->doubleData.cols());
+    binaryFile.write(reinterpret_cast<const char*>(record->doubleData.data()),\
+        record->doubleData.size()*sizeof(double));
+  }
+  else
+  {
+    writeRecordHeader(record,1,record->intData.rows(),\
+        record->intData.cols());
+    binaryFile.write(reinterpret_cast<const char*>(record->intData.data()),\
+        record->intData.size()*sizeof(int));
+  }
+
+};
+//==============================================================================
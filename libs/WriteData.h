@@ -1,6 +1,14 @@
 #ifndef WRITEDATA_H
 #define WRITEDATA_H 
 
+#include <fstream>
+#include <set>
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 class Mesh; // forward declaration
 
 using namespace std;
@@ -18,31 +26,44 @@ class WriteData
     // Variables
     string outputDirectory; 
     
+    // Output backends. Binary records are appended to a single file per run,
+    // with a companion index of record offsets for random access by time. A
+    // restarted run appends to the binary files of the run it continues.
+    bool writeCSV = true, writeBinary = false, restarting = false;
+    string binaryFileName = "output.qmb", indexFileName = "output.qmb.idx";
+    
     // Pointers 
     Mesh * mesh; 
 
+    // Asynchronous output. Writes are snapshotted into records and 
+    // serialized by a background thread. At most queueSize records are 
+    // pending; further writes block until the writer catches up.
+    bool async = false;
+    int queueSize = 64;
+
     // Functions
+    ~WriteData();
     void makeDirectory(string myDirName,\
         bool noTimeLabel = false); 
     void write(string myDirName,\
         string parameterName,\
-        Eigen::MatrixXd myData,\
+        const Eigen::MatrixXd & myData,\
         bool noTimeLabel = false);
     void write(string myDirName,\
         string parameterName,\
-        Eigen::VectorXd myData,\
+        const Eigen::VectorXd & myData,\
         bool noTimeLabel = false);
     void write(string myDirName,\
         string parameterName,\
-        Eigen::VectorXi myData,\
+        const Eigen::VectorXi & myData,\
         bool noTimeLabel = false);
     void write(string myDirName,\
         string parameterName,\
-        vector<double> myData,\
+        const vector<double> & myData,\
         bool noTimeLabel = false);
     void write(string myDirName,\
         string parameterName,\
-        vector<int> myData,\
+        const vector<int> & myData,\
         bool noTimeLabel = false);
     void write(string myDirName,\
         string parameterName,\
@@ -54,6 +75,48 @@ class WriteData
         bool noTimeLabel = false);
     string getOutputPath(string myDirName,\
         bool noTimeLabel = false); 
+    void makePath(string dir);
+    void setFormat(string format);
+    void setAsync(bool myAsync,int myQueueSize = 64);
+    void drain();
+    void finish();
+    void endStep();
+
+  private:
+
+    // Snapshot of one write. Records are recycled to reuse their buffers.
+    struct OutputRecord
+    {
+      string dir,name,parameterName;
+      double time;
+      bool noTimeLabel;
+      int dataType; // 0 double matrix, 1 int matrix, 2 double, 3 int, 4 flush
+      Eigen::MatrixXd doubleData;
+      Eigen::MatrixXi intData;
+    };
+
+    set<string> madeDirectories;
+    ofstream binaryFile,indexFile;
+    deque<OutputRecord*> pending,freeRecords;
+    mutex queueMutex,pathMutex;
+    condition_variable queueNotEmpty,queueNotFull;
+    thread writerThread;
+    bool stopWriter = false, writing = false;
+    int rank = 0;
+    OutputRecord * newRecord(string myDirName,\
+        string parameterName,\
+        int dataType,\
+        bool noTimeLabel);
+    void submit(OutputRecord * record);
+    void writerLoop();
+    void writeRecord(OutputRecord * record);
+    void openBinaryFiles();
+    void flushBinaryFiles();
+    void writeRecordHeader(OutputRecord * record,\
+        int dataType,\
+        int rows,\
+        int cols);
+    void writeBinaryRecord(OutputRecord * record);
 
 };
 
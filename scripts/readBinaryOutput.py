@@ -0,0 +1,126 @@
+"""Reader for the binary output written by QuasiMolto when outputFormat is 
+"binary" or "both". 
+
+Usage as a script:
+  python readBinaryOutput.py output/output.qmb            (list fields)
+  python readBinaryOutput.py output/output.qmb MGQD/flux  (print a field)
+
+Usage as a module:
+  import readBinaryOutput as rbo
+  out = rbo.BinaryOutput('output/output.qmb')
+  times = out.times('GGQD/flux')
+  flux = out.read('GGQD/flux', times[-1])
+"""
+
+import os
+import struct
+import sys
+
+import numpy as np
+
+DATA_TAG = b'QMOUT001'
+INDEX_TAG = b'QMIDX001'
+RECORD_TAG = b'QREC'
+DTYPES = {0: 'f8', 1: 'i4'}
+
+
+def _check_header(f, tag, fileName):
+  if f.read(8) != tag:
+    raise IOError(fileName + ' is not a QuasiMolto binary file')
+  order = f.read(4)
+  if struct.unpack('<i', order)[0] == 1:
+    return '<'
+  if struct.unpack('>i', order)[0] == 1:
+    return '>'
+  raise IOError('Could not determine byte order of ' + fileName)
+
+
+class BinaryOutput:
+  """Random access to the records in a QuasiMolto binary output file"""
+
+  def __init__(self, fileName):
+    self.fileName = fileName
+    self.entries = []
+    if os.path.exists(fileName + '.idx'):
+      self._readIndex(fileName + '.idx')
+    else:
+      self._scan()
+
+  def _readIndex(self, indexName):
+    with open(indexName, 'rb') as f:
+      self.order = _check_header(f, INDEX_TAG, indexName)
+      entry = struct.Struct(self.order + 'diqi')
+      while True:
+        chunk = f.read(entry.size)
+        if len(chunk) < entry.size:
+          break
+        time, hasTime, offset, nameLength = entry.unpack(chunk)
+        name = f.read(nameLength).decode()
+        self.entries.append((name, time if hasTime else None, offset))
+
+  def _scan(self):
+    """Rebuild the index from the data file if the index is missing"""
+    with open(self.fileName, 'rb') as f:
+      self.order = _check_header(f, DATA_TAG, self.fileName)
+      header = struct.Struct(self.order + 'iidiii')
+      while True:
+        offset = f.tell()
+        if f.read(4) != RECORD_TAG:
+          break
+        recordLength = struct.unpack(self.order + 'i', f.read(4))[0]
+        fields = f.read(header.size)
+        if len(fields) < header.size:
+          break
+        dataType, hasTime, time, rows, cols, nameLength = header.unpack(fields)
+        name = f.read(nameLength).decode()
+        self.entries.append((name, time if hasTime else None, offset))
+        f.seek(offset + 8 + recordLength)
+
+  def fields(self):
+    """Return the names of all fields in the file"""
+    return sorted(set(entry[0] for entry in self.entries))
+
+  def times(self, name):
+    """Return the times at which a field was written"""
+    return [entry[1] for entry in self.entries if entry[0] == name]
+
+  def read(self, name, time=None):
+    """Read a field. Without a time, the last record of the field is read."""
+    offsets = [entry[2] for entry in self.entries if entry[0] == name and \
+        (time is None or entry[1] is None or np.isclose(entry[1], time))]
+    if len(offsets) == 0:
+      raise KeyError(name + ' not found at time ' + str(time))
+    return self._readRecord(offsets[-1])
+
+  def _readRecord(self, offset):
+    header = struct.Struct(self.order + 'iidiii')
+    with open(self.fileName, 'rb') as f:
+      f.seek(offset)
+      if f.read(4) != RECORD_TAG:
+        raise IOError('Corrupt record at offset ' + str(offset))
+      f.read(4)
+      dataType, hasTime, time, rows, cols, nameLength = \
+          header.unpack(f.read(header.size))
+      f.read(nameLength)
+      dtype = np.dtype(self.order + DTYPES[dataType])
+      data = np.fromfile(f, dtype=dtype, count=rows*cols)
+    data = data.reshape((rows, cols), order='F')
+    if cols == 1:
+      data = data[:, 0]
+    if data.size == 1:
+      return data.flat[0]
+    return data
+
+
+if __name__ == '__main__':
+  if len(sys.argv) < 2:
+    print(__doc__)
+    sys.exit(1)
+  output = BinaryOutput(sys.argv[1])
+  if len(sys.argv) == 2:
+    for name in output.fields():
+      print(name, len(output.times(name)))
+  else:
+    for time in output.times(sys.argv[2]):
+      print('t =', time)
+      print(output.read(sys.argv[2], time))
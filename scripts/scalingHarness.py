@@ -0,0 +1,354 @@
+"""Strong and weak scaling harness for QuasiMolto.
+
+Generates a ladder of reference decks of increasing size, runs them over a
+grid of OpenMP thread counts and MPI ranks with the profiler enabled, and
+tabulates the per level (MGHOT, MGLOQD, ELOT) times from Profile/profile.csv
+into strong and weak scaling tables with parallel efficiencies.
+
+Usage:
+  python scalingHarness.py generate --decks scaling/decks
+  python scalingHarness.py run --exe build/bin/QuasiMolto --decks scaling/decks
+      --runs scaling/runs --threads 1,2,4,8 --ranks 1
+  python scalingHarness.py report --runs scaling/runs --strong ref-5
+
+Each deck in the ladder roughly doubles the work of the one before it
+(corner cells x energy groups), so the weak scaling series pairs deck ref-k
+with 2^k workers, where workers = threads x ranks. Runs with more than one
+rank set "petsc: true" and are launched through --mpirun.
+"""
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+import time
+
+LEVELS = ['MGHOT', 'MGLOQD', 'ELOT']
+
+# nZ, nR, energy groups, precursor groups, recirculation loop cells
+LADDER = [
+    (16, 8, 2, 2, 16),
+    (32, 8, 2, 4, 32),
+    (32, 16, 2, 6, 32),
+    (32, 16, 4, 6, 64),
+    (64, 16, 4, 6, 64),
+    (64, 32, 4, 6, 128),
+]
+
+BETAS = [0.000237389, 0.00154596, 0.0013822, 0.0028082801, 0.00082676503,
+         0.000285805]
+LAMBDAS = [0.0124378, 0.03063, 0.111474, 0.302248, 1.17229, 3.0747399]
+
+
+def _list(values):
+  return '[' + ','.join(repr(v) for v in values) + ']'
+
+
+def _ints(text):
+  return [int(v) for v in text.split(',') if v]
+
+
+def make_deck(nZ, nR, nGroups, nDNP, nRecirc, steps):
+  """Return the text of a reference deck.
+
+  Mesh sizes follow the micro-benchmarks: Z and R are given in corner cells
+  of the transport mesh with dz = dr = 2.
+  """
+  sigT, sigS, sigF, nu, neutV, chiP, flux = [], [], [], [], [], [], []
+  for iGroup in range(nGroups):
+    sigT.append(1.0 + 0.1*iGroup)
+    sigF.append(0.02 + 0.01*iGroup)
+    nu.append(2.43)
+    neutV.append(2.2E5*10.0**(nGroups-1-iGroup))
+    chiP.append(1.0 if iGroup == 0 else 0.0)
+    flux.append(1.0)
+    for iPrime in range(nGroups):
+      if iPrime == iGroup:
+        sigS.append(0.8)
+      elif iPrime == iGroup + 1:
+        sigS.append(0.1)
+      else:
+        sigS.append(0.0)
+
+  dt = 0.01
+  lines = [
+      'mesh:',
+      '  Z: %.1f' % nZ,
+      '  R: %.1f' % nR,
+      '  dz: 2.0',
+      '  dr: 2.0',
+      '  dt: %g' % dt,
+      '  T: %g' % (dt*steps),
+      '  recirculation Z: %.1f' % nRecirc,
+      '',
+      'geometry:',
+      '  background: fuel salt',
+      '',
+      'delayed neutron precursors:',
+      '  betas: ' + _list(BETAS[:nDNP]),
+      '  lambdas: ' + _list(LAMBDAS[:nDNP]),
+      '',
+      'materials:',
+      '  fuel salt:',
+      '    sigT: ' + _list(sigT),
+      '    sigF: ' + _list(sigF),
+      '    sigS: ' + _list(sigS),
+      '    nu: ' + _list(nu),
+      '    neutV: ' + _list(neutV),
+      '    chiP: ' + _list(chiP),
+      '    chiD: ' + _list(chiP),
+      '    density: 2.146E-3',
+      '    cP: 1967.0',
+      '    k: 0.0553',
+      '    gamma: 0.0',
+      '    omega: 3.204E-11',
+      '    material velocity: 21.45',
+      '    stationary: false',
+      '',
+      'parameters:',
+      '  epsAlpha: 1E-3',
+      '  epsFlux: 1E-5',
+      '  epsFissionSource: 1E-5',
+      '  epsEddington: 1E-6',
+      '  upperBC: [0.0]',
+      '  lowerBC: [0.0]',
+      '  outerBC: [0.0]',
+      '  initial flux: ' + _list(flux),
+      '  initial alpha: [1E-15]',
+      '  initial previous flux: ' + _list(flux),
+      '  initial dnp concentration: 0.0',
+      '  initial recirc dnp concentration: 0.0',
+      '  solve type: transient',
+      '  wallTemp: 920',
+      '  inletTemp: 920',
+      '  mgqd-bcs: goldin',
+      '  epsMPQD: 1E-8',
+      '  ratedPower: 10E6',
+      '  relaxTolELOT: 1',
+      '  relaxTolMGLOQD: 1',
+      '  resetThreshold: 1',
+      '  verbose: false',
+      '  outputEveryNSteps: %d' % steps,
+  ]
+  return '\n'.join(lines) + '\n'
+
+
+def generate(args):
+  """Write the reference ladder to the deck directory"""
+  os.makedirs(args.decks, exist_ok=True)
+  for iDeck, (nZ, nR, nGroups, nDNP, nRecirc) in enumerate(LADDER):
+    name = os.path.join(args.decks, 'ref-%d.yaml' % iDeck)
+    with open(name, 'w') as f:
+      f.write(make_deck(nZ, nR, nGroups, nDNP, nRecirc, args.steps))
+    print('%s: %dx%d cells, %d groups, %d precursor groups, %d recirc cells'
+          % (name, nZ, nR, nGroups, nDNP, nRecirc))
+
+
+def run_parameters(threads, ranks):
+  """Parameters appended to a deck for one point of the run grid"""
+  return ['  nprocs: %d' % threads,
+          '  petsc: %s' % ('true' if ranks > 1 else 'false'),
+          '  profile: true',
+          '  outputDirectory: output/']
+
+
+def run(args):
+  """Run every deck over the threads x ranks grid"""
+  decks = sorted(f[:-5] for f in os.listdir(args.decks)
+                 if f.endswith('.yaml'))
+  if args.filter:
+    decks = [d for d in decks if d in args.filter.split(',')]
+  exe = os.path.abspath(args.exe)
+
+  for deck in decks:
+    with open(os.path.join(args.decks, deck + '.yaml')) as f:
+      text = f.read()
+    for ranks in _ints(args.ranks):
+      for threads in _ints(args.threads):
+        runDir = os.path.join(args.runs, deck, 't%d-r%d' % (threads, ranks))
+        profile = os.path.join(runDir, 'output', 'Profile', 'profile.csv')
+        if os.path.exists(profile) and not args.force:
+          print('Skipping ' + runDir)
+          continue
+        os.makedirs(runDir, exist_ok=True)
+
+        # The parameters block is last in the generated decks
+        with open(os.path.join(runDir, 'input.yaml'), 'w') as f:
+          f.write(text + '\n'.join(run_parameters(threads, ranks)) + '\n')
+
+        command = [exe, 'input.yaml']
+        if ranks > 1:
+          command = args.mpirun.split() + ['-np', str(ranks)] + command
+        env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+
+        print('Running %s with %d threads and %d ranks' % (deck, threads, ranks))
+        start = time.time()
+        with open(os.path.join(runDir, 'log.txt'), 'w') as log:
+          status = subprocess.call(command, cwd=runDir, env=env, stdout=log,
+                                   stderr=subprocess.STDOUT)
+        with open(os.path.join(runDir, 'wall.txt'), 'w') as f:
+          f.write('%.6f\n' % (time.time() - start))
+        if status != 0:
+          print('  failed with status %d, see %s' % (status,
+              os.path.join(runDir, 'log.txt')))
+
+
+def read_run(runDir):
+  """Per level times and total wall time of one run, or None if missing"""
+  profile = os.path.join(runDir, 'output', 'Profile', 'profile.csv')
+  if not os.path.exists(profile):
+    return None
+  times = dict((level, 0.0) for level in LEVELS)
+  with open(profile) as f:
+    for row in csv.DictReader(f):
+      if row['type'] == 'timer' and row['name'] in times:
+        times[row['name']] = float(row['value'])
+  wall = os.path.join(runDir, 'wall.txt')
+  if os.path.exists(wall):
+    with open(wall) as f:
+      times['wall'] = float(f.read())
+  else:
+    times['wall'] = sum(times[level] for level in LEVELS)
+  return times
+
+
+def collect(runs):
+  """Map (deck, threads, ranks) to the times of every completed run"""
+  results = {}
+  if not os.path.isdir(runs):
+    return results
+  for deck in sorted(os.listdir(runs)):
+    if not os.path.isdir(os.path.join(runs, deck)):
+      continue
+    for point in sorted(os.listdir(os.path.join(runs, deck))):
+      try:
+        threads, ranks = [int(v[1:]) for v in point.split('-')]
+      except ValueError:
+        continue
+      times = read_run(os.path.join(runs, deck, point))
+      if times is not None:
+        results[(deck, threads, ranks)] = times
+  return results
+
+
+def strong_table(results, deck):
+  """Speedup and efficiency of a fixed deck relative to its fewest workers"""
+  points = sorted(((t*r, t, r) for (d, t, r) in results if d == deck))
+  if not points:
+    return []
+  baseWorkers, baseThreads, baseRanks = points[0]
+  base = results[(deck, baseThreads, baseRanks)]
+  rows = []
+  for workers, threads, ranks in points:
+    times = results[(deck, threads, ranks)]
+    for level in LEVELS + ['wall']:
+      if times[level] <= 0.0 or base[level] <= 0.0:
+        continue
+      speedup = base[level]/times[level]
+      efficiency = speedup*baseWorkers/workers
+      rows.append([deck, threads, ranks, workers, level, times[level],
+                   speedup, efficiency])
+  return rows
+
+
+def weak_table(results):
+  """Efficiency of deck ref-k run on 2^k workers relative to ref-0"""
+  rows = []
+  base = {}
+  for (deck, threads, ranks), times in sorted(results.items()):
+    if not deck.startswith('ref-'):
+      continue
+    workers = threads*ranks
+    if workers != 2**int(deck[4:]):
+      continue
+    for level in LEVELS + ['wall']:
+      if times[level] <= 0.0:
+        continue
+      if workers == 1:
+        base[level] = times[level]
+      rows.append([deck, threads, ranks, workers, level, times[level]])
+  for row in rows:
+    row.append(base[row[4]]/row[5] if row[4] in base else float('nan'))
+  return sorted(rows, key=lambda row: (row[4], row[3], row[2]))
+
+
+def print_table(title, header, rows):
+  print('\n' + title)
+  print(' '.join('%10s' % h for h in header))
+  for row in rows:
+    print(' '.join(('%10.4g' % v) if isinstance(v, float) else ('%10s' % v)
+                   for v in row))
+
+
+def report(args):
+  """Write and print the strong and weak scaling tables"""
+  results = collect(args.runs)
+  if not results:
+    print('No completed runs found in ' + args.runs)
+    return 1
+
+  decks = sorted(set(d for (d, t, r) in results))
+  strongDecks = args.strong.split(',') if args.strong else [decks[-1]]
+  strong = []
+  for deck in strongDecks:
+    strong += strong_table(results, deck)
+  weak = weak_table(results)
+
+  strongHeader = ['deck', 'threads', 'ranks', 'workers', 'level', 'seconds',
+                  'speedup', 'efficiency']
+  weakHeader = ['deck', 'threads', 'ranks', 'workers', 'level', 'seconds',
+                'efficiency']
+  for name, header, rows in [('strong_scaling.csv', strongHeader, strong),
+                             ('weak_scaling.csv', weakHeader, weak)]:
+    with open(os.path.join(args.runs, name), 'w') as f:
+      writer = csv.writer(f)
+      writer.writerow(header)
+      writer.writerows(rows)
+
+  print_table('Strong scaling', strongHeader, strong)
+  print_table('Weak scaling', weakHeader, weak)
+  return 0
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+  sub = parser.add_subparsers(dest='command')
+
+  gen = sub.add_parser('generate', help='write the reference decks')
+  gen.add_argument('--decks', default='scaling/decks')
+  gen.add_argument('--steps', type=int, default=10,
+                   help='number of transient steps per deck')
+
+  runner = sub.add_parser('run', help='run decks over threads and ranks')
+  runner.add_argument('--exe', required=True, help='QuasiMolto executable')
+  runner.add_argument('--decks', default='scaling/decks')
+  runner.add_argument('--runs', default='scaling/runs')
+  runner.add_argument('--threads', default='1')
+  runner.add_argument('--ranks', default='1')
+  runner.add_argument('--mpirun', default='mpirun')
+  runner.add_argument('--filter', default='',
+                      help='comma separated deck names to run')
+  runner.add_argument('--force', action='store_true',
+                      help='rerun points that already have a profile')
+
+  rep = sub.add_parser('report', help='tabulate strong and weak scaling')
+  rep.add_argument('--runs', default='scaling/runs')
+  rep.add_argument('--strong', default='',
+                   help='comma separated decks for strong scaling '
+                        '(default: largest)')
+
+  args = parser.parse_args()
+  if args.command == 'generate':
+    generate(args)
+  elif args.command == 'run':
+    run(args)
+  elif args.command == 'report':
+    return report(args)
+  else:
+    parser.print_help()
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,151 @@
+"""Reader and summarizer for the convergence trace written by QuasiMolto when
+convergenceTrace is true.
+
+Usage as a script:
+  python summarizeConvergence.py output/convergence.qct           (summary)
+  python summarizeConvergence.py output/convergence.qct --steps   (per step)
+  python summarizeConvergence.py output/convergence.qct --csv trace.csv
+
+Usage as a module:
+  import summarizeConvergence as sc
+  trace = sc.read('output/convergence.qct')
+  elot = trace['level'] == sc.LEVELS['ELOT']
+  print(trace['fluxResidual'][elot])
+
+The summary is meant for tuning relaxTolELOT, relaxTolMGLOQD, and
+resetThreshold. Many resets at a level suggest resetThreshold is too tight.
+Residuals far below their target when a level converges (a large
+"overshoot") suggest the relaxation tolerance of that level can be loosened.
+"""
+
+import argparse
+import struct
+import sys
+
+import numpy as np
+
+TRACE_TAG = b'QMCTR001'
+BLOCK_TAG = b'QBLK'
+DTYPES = {0: 'f8', 1: 'i4'}
+LEVELS = {'ELOT': 1, 'MGLOQD': 2, 'MGHOT': 3}
+DECISIONS = {'iterate': 0, 'converged': 1, 'reset': 2, 'skipped': 3}
+
+
+def read(fileName):
+  """Return a dictionary of numpy arrays, one per column"""
+  with open(fileName, 'rb') as f:
+    if f.read(8) != TRACE_TAG:
+      raise IOError(fileName + ' is not a QuasiMolto convergence trace')
+    order = f.read(4)
+    if struct.unpack('<i', order)[0] == 1:
+      bo = '<'
+    elif struct.unpack('>i', order)[0] == 1:
+      bo = '>'
+    else:
+      raise IOError('Could not determine byte order of ' + fileName)
+
+    nColumns = struct.unpack(bo + 'i', f.read(4))[0]
+    columns = []
+    for iColumn in range(nColumns):
+      dataType, nameLength = struct.unpack(bo + 'ii', f.read(8))
+      columns.append((f.read(nameLength).decode(), bo + DTYPES[dataType]))
+
+    blocks = dict((name, []) for name, dtype in columns)
+    while True:
+      tag = f.read(4)
+      if len(tag) < 4:
+        break
+      if tag != BLOCK_TAG:
+        raise IOError('Corrupt block in ' + fileName)
+      nRecords = struct.unpack(bo + 'i', f.read(4))[0]
+      for name, dtype in columns:
+        count = nRecords*np.dtype(dtype).itemsize
+        blocks[name].append(np.frombuffer(f.read(count), dtype=dtype))
+
+  return dict((name, np.concatenate(blocks[name]) if blocks[name]
+               else np.zeros(0, dtype=dtype)) for name, dtype in columns)
+
+
+def summarize(trace):
+  """Print iteration, reset, Krylov, and timing statistics for each level"""
+  nSteps = len(np.unique(trace['step']))
+  print('%d records over %d steps' % (len(trace['step']), nSteps))
+  print('%8s %8s %9s %7s %7s %9s %9s %10s' % ('level', 'iters', 'per step',
+        'resets', 'skips', 'krylov', 'seconds', 'overshoot'))
+
+  for name in ['MGHOT', 'MGLOQD', 'ELOT']:
+    mask = trace['level'] == LEVELS[name]
+    if not mask.any():
+      continue
+    decision = trace['decision'][mask]
+    converged = mask & (trace['decision'] == DECISIONS['converged'])
+
+    # How far below the looser of the two targets the converged iterate was
+    overshoot = np.nan
+    if converged.any():
+      ratio = np.minimum(trace['fluxTarget'][converged]
+                         / np.maximum(trace['fluxResidual'][converged], 1E-300),
+                         trace['tempTarget'][converged]
+                         / np.maximum(trace['tempResidual'][converged], 1E-300))
+      overshoot = np.exp(np.mean(np.log(ratio)))
+
+    print('%8s %8d %9.2f %7d %7d %9d %9.3g %10.3g' % (name, mask.sum(),
+          mask.sum()/float(nSteps), (decision == DECISIONS['reset']).sum(),
+          (decision == DECISIONS['skipped']).sum(),
+          trace['krylovIterations'][mask].sum(),
+          trace['seconds'][mask].sum(), overshoot))
+
+  mghot = (trace['level'] == LEVELS['MGHOT']) \
+      & np.isfinite(trace['eddingtonResidual'])
+  if mghot.any():
+    print('Eddington factor change per MGHOT solve: median %.3g, max %.3g'
+          % (np.median(trace['eddingtonResidual'][mghot]),
+             trace['eddingtonResidual'][mghot].max()))
+
+
+def summarize_steps(trace):
+  """Print the iteration counts of each level in each step"""
+  print('%8s %12s %6s %7s %5s %7s' % ('step', 'time', 'MGHOT', 'MGLOQD',
+        'ELOT', 'resets'))
+  for step in np.unique(trace['step']):
+    mask = trace['step'] == step
+    counts = [(mask & (trace['level'] == LEVELS[name])).sum()
+              for name in ['MGHOT', 'MGLOQD', 'ELOT']]
+    resets = (mask & (trace['decision'] == DECISIONS['reset'])).sum()
+    print('%8d %12.6g %6d %7d %5d %7d' % (step, trace['time'][mask][0],
+          counts[0], counts[1], counts[2], resets))
+
+
+def write_csv(trace, fileName):
+  """Write every record as a row of a CSV file"""
+  names = list(trace.keys())
+  with open(fileName, 'w') as f:
+    f.write(','.join(names) + '\n')
+    for iRecord in range(len(trace['step'])):
+      f.write(','.join(repr(trace[name][iRecord].item()) for name in names)
+              + '\n')
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+  parser.add_argument('fileName')
+  parser.add_argument('--steps', action='store_true',
+                      help='print iteration counts for every step')
+  parser.add_argument('--csv', default='', help='also write records as CSV')
+  args = parser.parse_args()
+
+  trace = read(args.fileName)
+  if len(trace['step']) == 0:
+    print('No records in ' + args.fileName)
+    return 1
+
+  summarize(trace)
+  if args.steps:
+    summarize_steps(trace)
+  if args.csv:
+    write_csv(trace, args.csv)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,130 @@
+#include <cstdio>
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/WriteData.h"
+
+using namespace std;
+
+// read a value of type T from a binary stream
+template <class T>
+T readValue(ifstream & file)
+{
+  T value;
+  file.read(reinterpret_cast<char*>(&value),sizeof(T));
+  return value;
+}
+
+// read the record at offset and check that it holds data at time
+bool checkRecord(ifstream & binaryFile,long long offset,string name,\
+  double time,const Eigen::MatrixXd & data)
+{
+  char tag[4];
+  int recordLength,dataType,hasTime,rows,cols,nameLength;
+  double recordTime;
+  string recordName;
+  Eigen::MatrixXd recordData;
+
+  binaryFile.seekg(offset);
+  binaryFile.read(tag,4);
+  recordLength = readValue<int>(binaryFile);
+  dataType = readValue<int>(binaryFile);
+  hasTime = readValue<int>(binaryFile);
+  recordTime = readValue<double>(binaryFile);
+  rows = readValue<int>(binaryFile);
+  cols = readValue<int>(binaryFile);
+  nameLength = readValue<int>(binaryFile);
+  recordName.resize(nameLength);
+  binaryFile.read(&recordName[0],nameLength);
+  recordData.resize(rows,cols);
+  binaryFile.read(reinterpret_cast<char*>(recordData.data()),\
+    rows*cols*sizeof(double));
+
+  return binaryFile.good() and string(tag,4) == "QREC" and dataType == 0 \
+    and hasTime == 1 and recordTime == time and recordName == name \
+    and recordLength == int(5*sizeof(int) + sizeof(double) + nameLength \
+      + rows*cols*sizeof(double)) \
+    and recordData == data;
+}
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  PetscErrorCode ierr;
+  int status = 0,byteOrder;
+  char tag[8];
+  string dir = "binaryOutputTest/";
+  vector<string> names;
+  vector<double> times;
+  vector<long long> offsets;
+  double firstTime,secondTime;
+
+  Mesh * myMesh;
+  myMesh = new Mesh(input);
+
+  remove((dir + "output.qmb").c_str());
+  remove((dir + "output.qmb.idx").c_str());
+
+  // write one field at two times, then continue the output as a restarted
+  // run would
+  Eigen::MatrixXd flux = Eigen::MatrixXd::Random(3,2);
+  Eigen::MatrixXd temp = Eigen::MatrixXd::Random(2,4);
+  Eigen::MatrixXd laterFlux = 2.0*flux, laterTemp = 2.0*temp;
+
+  WriteData * output;
+  output = new WriteData(myMesh,dir);
+  output->setFormat("binary");
+  firstTime = myMesh->ts[myMesh->state];
+  output->write("","flux",flux);
+  output->write("","temp",temp);
+  myMesh->advanceOneTimeStep();
+  secondTime = myMesh->ts[myMesh->state];
+  output->write("","flux",laterFlux);
+  delete output;
+
+  output = new WriteData(myMesh,dir);
+  output->setFormat("binary");
+  output->restarting = true;
+  output->write("","temp",laterTemp);
+  delete output;
+
+  // the index should list every record, in order, under a single header
+  ifstream indexFile(dir + "output.qmb.idx",ios::binary);
+  indexFile.read(tag,8);
+  byteOrder = readValue<int>(indexFile);
+  if (string(tag,8) != "QMIDX001" or byteOrder != 1)
+    status = 1;
+
+  while (indexFile.peek() != EOF)
+  {
+    times.push_back(readValue<double>(indexFile));
+    readValue<int>(indexFile);
+    offsets.push_back(readValue<long long>(indexFile));
+    names.push_back(string(readValue<int>(indexFile),' '));
+    indexFile.read(&names.back()[0],names.back().size());
+  }
+
+  ifstream binaryFile(dir + "output.qmb",ios::binary);
+  binaryFile.read(tag,8);
+  byteOrder = readValue<int>(binaryFile);
+  if (string(tag,8) != "QMOUT001" or byteOrder != 1)
+    status = 1;
+
+  if (names.size() != 4)
+    status = 1;
+  else if (names[0] != "flux" or names[1] != "temp" or names[2] != "flux" \
+    or names[3] != "temp" or times[0] != firstTime or times[1] != firstTime \
+    or times[2] != secondTime or times[3] != secondTime)
+    status = 1;
+  else if (not checkRecord(binaryFile,offsets[0],"flux",firstTime,flux)\
+    or not checkRecord(binaryFile,offsets[1],"temp",firstTime,temp)\
+    or not checkRecord(binaryFile,offsets[2],"flux",secondTime,laterFlux)\
+    or not checkRecord(binaryFile,offsets[3],"temp",secondTime,laterTemp))
+    status = 1;
+
+  ierr = PetscFinalize();
+  return status;
+}
@@ -0,0 +1,39 @@
+#include "../../libs/Checkpoint.h"
+#include "../../libs/Logger.h"
+
+using namespace std;
+
+int main()
+{
+  // fields written to a checkpoint should be read back unchanged
+  Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(3,4), matrixIn;
+  Eigen::VectorXi indices(2), indicesIn;
+  double time = 0.25, timeIn = 0.0;
+  int state = 7, stateIn = 0;
+  indices << 3,-1;
+
+  Logger * logger;
+  logger = new Logger(NULL);
+
+  Checkpoint * archive;
+  archive = new Checkpoint(true,logger);
+  archive->field("matrix",matrix);
+  archive->field("indices",indices);
+  archive->field("time",time);
+  archive->field("state",state);
+  if (not archive->write("checkpointTest.qmc"))
+    return 1;
+
+  archive = new Checkpoint(false,logger);
+  if (not archive->read("checkpointTest.qmc"))
+    return 1;
+  archive->field("matrix",matrixIn);
+  archive->field("indices",indicesIn);
+  archive->field("time",timeIn);
+  archive->field("state",stateIn);
+  archive->field("missing",timeIn);
+
+  if (matrixIn != matrix or indicesIn != indices or stateIn != state \
+      or timeIn != time or archive->nMissing != 1)
+    return 1;
+}
@@ -0,0 +1,68 @@
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiGroupTransport.h"
+#include "../../libs/MultiGroupQD.h"
+#include "../../libs/MultiPhysicsCoupledQD.h"
+#include "../../libs/MultilevelCoupling.h"
+#include "../../libs/GreyGroupQD.h"
+#include "../../libs/GreyGroupCMFD.h"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  (*input)["parameters"]["cmfdCoarsenZ"] = 2;
+  (*input)["parameters"]["cmfdCoarsenR"] = 2;
+  PetscErrorCode ierr;
+  int status = 0;
+  double before,after;
+
+  Mesh * myMesh;
+  myMesh = new Mesh(input);
+
+  Materials * myMaterials;
+  myMaterials = new Materials(myMesh,input);
+
+  MultiGroupTransport * myMGT;
+  myMGT = new MultiGroupTransport(myMaterials,myMesh,input);
+
+  MultiGroupQD * myMGQD;
+  myMGQD = new MultiGroupQD(myMaterials,myMesh,input);
+
+  MultiPhysicsCoupledQD * myMPQD;
+  myMPQD = new MultiPhysicsCoupledQD(myMaterials,myMesh,input);
+
+  MultilevelCoupling * myMLCoupling;
+  myMLCoupling = new MultilevelCoupling(myMesh,myMaterials,input,myMGT,\
+    myMGQD,myMPQD);
+
+  if (not myMPQD->cmfd->enabled \
+    or not myMLCoupling->solveOneStepResidualBalance(false))
+  {
+    PetscFinalize();
+    return 1;
+  }
+
+  // an iterate with the right flux shape but the wrong amplitude should be
+  // rebalanced to a much smaller residual
+  myMPQD->solveSuperLU();
+  Eigen::VectorXd guess = myMPQD->x;
+  guess.segment(myMPQD->ggqd->indexOffset,myMPQD->ggqd->nUnknowns) *= 2.0;
+
+  before = (myMPQD->b - myMPQD->A*guess).norm();
+  if (not myMPQD->cmfd->accelerate(myMPQD->A,myMPQD->b,guess))
+    status = 1;
+  after = (myMPQD->b - myMPQD->A*guess).norm();
+
+  if (after > 1E-2*before)
+    status = 1;
+
+  ierr = PetscFinalize();
+  return status;
+}
@@ -0,0 +1,165 @@
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiGroupTransport.h"
+#include "../../libs/SingleGroupTransport.h"
+#include "../../libs/CoarseMeshTransport.h"
+
+using namespace std;
+
+// whether value is one of the entries of edges
+bool isEdge(double value,const arma::rowvec & edges)
+{
+  for (int iEdge = 0; iEdge < edges.n_elem; iEdge++)
+  {
+    if (abs(edges(iEdge) - value) < 1E-12)
+      return true;
+  }
+  return false;
+}
+
+// check overlap, interpolation, and edges of a coarsening of one direction
+int checkCoarsening(CoarseMeshTransport * coarseMGHOT,\
+  const arma::rowvec & fineEdges,const arma::rowvec & fineCent,\
+  const arma::rowvec & coarseEdges,const arma::rowvec & coarseCent,\
+  bool radial)
+{
+  int status = 0;
+  double coarseSize,linear,interpolated;
+
+  // the coarse edges are fine edges and span the same domain
+  for (int iEdge = 0; iEdge < coarseEdges.n_elem; iEdge++)
+  {
+    if (not isEdge(coarseEdges(iEdge),fineEdges))
+      status = 1;
+  }
+  if (coarseEdges(0) != fineEdges(0) \
+    or coarseEdges(coarseEdges.n_elem-1) != fineEdges(fineEdges.n_elem-1))
+    status = 1;
+
+  // the fine corners overlapping a coarse corner fill it exactly
+  Eigen::MatrixXd overlap = coarseMGHOT->calcOverlap(fineEdges,coarseEdges,\
+    radial);
+  for (int iCoarse = 0; iCoarse < overlap.rows(); iCoarse++)
+  {
+    if (radial)
+      coarseSize = M_PI*(pow(coarseEdges(iCoarse+1),2) \
+        - pow(coarseEdges(iCoarse),2));
+    else
+      coarseSize = coarseEdges(iCoarse+1) - coarseEdges(iCoarse);
+
+    if (abs(overlap.row(iCoarse).sum() - coarseSize) > 1E-12*coarseSize)
+      status = 1;
+  }
+
+  // interpolation weights form a partition of unity and reproduce a linear
+  // field between the outermost coarse centers
+  Eigen::MatrixXd interp = coarseMGHOT->calcInterpolation(fineCent,\
+    coarseCent);
+  Eigen::VectorXd coarseField(coarseCent.n_elem);
+  for (int iCoarse = 0; iCoarse < coarseCent.n_elem; iCoarse++)
+    coarseField(iCoarse) = 2.0 + 3.0*coarseCent(iCoarse);
+
+  for (int iFine = 0; iFine < fineCent.n_elem; iFine++)
+  {
+    if (abs(interp.row(iFine).sum() - 1.0) > 1E-12)
+      status = 1;
+
+    if (fineCent(iFine) < coarseCent(0) \
+      or fineCent(iFine) > coarseCent(coarseCent.n_elem-1))
+      continue;
+
+    linear = 2.0 + 3.0*fineCent(iFine);
+    interpolated = interp.row(iFine).dot(coarseField);
+    if (abs(interpolated - linear) > 1E-12*linear)
+      status = 1;
+  }
+
+  return status;
+}
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  (*input)["mesh"]["dz"] = 0.125;
+  (*input)["mesh"]["dr"] = 0.125;
+  (*input)["parameters"]["mghotCoarsenZ"] = 3;
+  (*input)["parameters"]["mghotCoarsenR"] = 2;
+  PetscErrorCode ierr;
+  int status = 0;
+  double difference,largest;
+
+  Mesh * myMesh;
+  myMesh = new Mesh(input);
+
+  Materials * myMaterials;
+  myMaterials = new Materials(myMesh,input);
+
+  MultiGroupTransport * myMGT;
+  myMGT = new MultiGroupTransport(myMaterials,myMesh,input);
+
+  CoarseMeshTransport * coarseMGHOT;
+  coarseMGHOT = new CoarseMeshTransport(myMesh,myMaterials,input,myMGT);
+  Mesh * coarseMesh = coarseMGHOT->coarseMesh;
+
+  if (not coarseMGHOT->enabled)
+    status = 1;
+
+  // a region boundary that is not a multiple of the coarsening factor stays
+  // an edge of the coarse mesh
+  vector<double> keptEdges = coarseMGHOT->coarsenEdges(myMesh->zEdge,3,\
+    {0.25});
+  arma::rowvec coarseEdges(keptEdges);
+  if (not isEdge(0.25,coarseEdges) or coarseEdges.n_elem != 4)
+    status = 1;
+
+  if (checkCoarsening(coarseMGHOT,myMesh->zCornerEdge,myMesh->zCornerCent,\
+    coarseMesh->zCornerEdge,coarseMesh->zCornerCent,false) != 0)
+    status = 1;
+
+  if (checkCoarsening(coarseMGHOT,myMesh->rCornerEdge,myMesh->rCornerCent,\
+    coarseMesh->rCornerEdge,coarseMesh->rCornerCent,true) != 0)
+    status = 1;
+
+  // sweeping on a coarse mesh with factors of 1 should reproduce the sweep
+  // on the fine mesh
+  (*input)["parameters"]["mghotCoarsenZ"] = 1;
+  (*input)["parameters"]["mghotCoarsenR"] = 1;
+  myMesh = new Mesh(input);
+  myMaterials = new Materials(myMesh,input);
+  myMGT = new MultiGroupTransport(myMaterials,myMesh,input);
+  coarseMGHOT = new CoarseMeshTransport(myMesh,myMaterials,input,myMGT);
+
+  myMGT->calcSources();
+  myMGT->calcAlphas();
+  for (int iGroup = 0; iGroup < myMGT->SGTs.size(); iGroup++)
+  {
+    shared_ptr<SingleGroupTransport> fine = myMGT->SGTs[iGroup];
+    fine->solveStartAngle();
+    fine->solveSCB();
+    arma::cube fineFlux = fine->aFlux;
+
+    fine->aFlux.zeros();
+    coarseMGHOT->restrictState();
+    coarseMGHOT->sweepGroup(iGroup);
+
+    difference = 0.0;
+    largest = 0.0;
+    for (int iEntry = 0; iEntry < fineFlux.n_elem; iEntry++)
+    {
+      difference = max(difference,\
+        abs(fine->aFlux.memptr()[iEntry] - fineFlux.memptr()[iEntry]));
+      largest = max(largest,abs(fineFlux.memptr()[iEntry]));
+    }
+
+    if (not coarseMGHOT->enabled or difference > 1E-10*largest)
+      status = 1;
+  }
+
+  ierr = PetscFinalize();
+  return status;
+}
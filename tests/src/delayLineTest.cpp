@@ -0,0 +1,95 @@
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiPhysicsCoupledQD.h"
+#include "../../libs/MultiGroupDNP.h"
+#include "../../libs/SingleGroupDNP.h"
+
+using namespace std;
+
+// concentration leaving the core, linear so that interpolating the outlet
+// history is exact
+double outletConc(double time)
+{
+  return 1.0 + 50.0*time;
+}
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  (*input)["mesh"]["T"] = 0.02;
+  (*input)["parameters"]["recircModel"] = "delay line";
+  (*input)["delayed neutron precursors"]["lambdas"].push_back(10.0);
+  (*input)["delayed neutron precursors"]["betas"].push_back(0.0065);
+  PetscErrorCode ierr;
+  int status = 0;
+  double time,transitTime,expected,stagnantConc = 2.0;
+
+  Mesh * myMesh;
+  myMesh = new Mesh(input);
+
+  Materials * myMaterials;
+  myMaterials = new Materials(myMesh,input);
+
+  MultiPhysicsCoupledQD * myMPQD;
+  myMPQD = new MultiPhysicsCoupledQD(myMaterials,myMesh,input);
+
+  SingleGroupDNP * dnp = myMPQD->mgdnp->DNPs[0].get();
+  int nR = dnp->recircConc.cols(), iStagnant = nR-1;
+
+  // plug flow in every column but the last, which is stagnant
+  myMaterials->recircFlowVelocity.setConstant(100.0);
+  myMaterials->recircFlowVelocity.col(iStagnant).setZero();
+
+  dnp->recircConc.setConstant(stagnantConc);
+  dnp->dnpConc.row(dnp->recircInletIndex).setConstant(\
+    outletConc(myMesh->ts[myMesh->state-1]));
+  dnp->calcRecircTransitTimes();
+  dnp->resetOutletHistory(myMesh->ts[myMesh->state-1]);
+
+  if (dnp->recircFlows[iStagnant] or not dnp->recircFlows[0])
+    status = 1;
+
+  // each cell should hold fluid that left the core one transit time ago,
+  // attenuated by decay over that transit, C_out(t-tau)exp(-lambda tau)
+  for (int iTime = myMesh->state-1; iTime < myMesh->dts.size(); iTime++)
+  {
+    time = myMesh->ts[myMesh->state];
+    dnp->calcDelayLineRecircConc(false);
+
+    for (int iR = 0; iR < nR; iR++)
+    {
+      for (int iZ = 0; iZ < dnp->recircConc.rows(); iZ++)
+      {
+        transitTime = dnp->recircTransitTimes(iZ,iR);
+
+        if (iR == iStagnant)
+          expected = stagnantConc*exp(-dnp->lambda*time);
+        else if (transitTime <= time)
+          expected = outletConc(time - transitTime)\
+                     *exp(-dnp->lambda*transitTime);
+        else
+          continue;
+
+        if (abs(dnp->recircConc(iZ,iR) - expected) > 1E-10*expected)
+          status = 1;
+      }
+    }
+
+    dnp->dnpConc.row(dnp->recircInletIndex).setConstant(outletConc(time));
+    dnp->updateOutletHistory();
+    myMesh->advanceOneTimeStep();
+  }
+
+  // the history buffer holds about two transit times, not one entry per
+  // unit of the stagnant column's infinite transit time
+  if (dnp->historyTimes.size() > myMesh->dts.size() + 2)
+    status = 1;
+
+  ierr = PetscFinalize();
+  return status;
+}
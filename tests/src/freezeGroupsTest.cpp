@@ -0,0 +1,58 @@
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiGroupTransport.h"
+#include "../../libs/MultiGroupQD.h"
+#include "../../libs/TransportToQDCoupling.h"
+
+using namespace std;
+
+MultiGroupTransport * solve(YAML::Node * input)
+{
+  Mesh * myMesh;
+  myMesh = new Mesh(input);
+
+  Materials * myMaterials;
+  myMaterials = new Materials(myMesh,input);
+
+  MultiGroupTransport * myMGT;
+  myMGT = new MultiGroupTransport(myMaterials,myMesh,input);
+
+  MultiGroupQD * myMGQD;
+  myMGQD = new MultiGroupQD(myMaterials,myMesh,input);
+
+  TransportToQDCoupling * myT2QD;
+  myT2QD = new TransportToQDCoupling(myMaterials,myMesh,input,myMGT,myMGQD);
+  myT2QD->solveTransportWithQDAcceleration();
+
+  return myMGT;
+}
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  PetscErrorCode ierr;
+  int status = 0;
+
+  // freezing converged groups should only skip work, the scalar fluxes
+  // written out should match a run that sweeps every group every time
+  MultiGroupTransport * unfrozen = solve(input);
+
+  (*input)["parameters"]["freezeGroups"] = true;
+  MultiGroupTransport * frozen = solve(input);
+
+  for (int iGroup = 0; iGroup < unfrozen->SGTs.size(); iGroup++)
+  {
+    Eigen::MatrixXd difference = frozen->SGTs[iGroup]->sFlux \
+      - unfrozen->SGTs[iGroup]->sFlux;
+    if (difference.norm() > 1E-3*unfrozen->SGTs[iGroup]->sFlux.norm())
+      status = 1;
+  }
+
+  ierr = PetscFinalize();
+  return status;
+}
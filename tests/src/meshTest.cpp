@@ -12,4 +12,75 @@ int main()
   // initialize mesh object
   Mesh * myMesh;
   myMesh = new Mesh(input);
+
+  YAML::Node * edgeInput;
+  edgeInput = new YAML::Node;
+  *edgeInput = YAML::Clone(*input);
+  (*edgeInput)["mesh"]["z edges"] = YAML::Load("[0.0, 0.2, 0.5, 1.0]");
+
+  YAML::Node * zoneInput;
+  zoneInput = new YAML::Node;
+  *zoneInput = YAML::Clone(*input);
+  (*zoneInput)["mesh"]["z zones"] = \
+    YAML::Load("[{upper: 1.0, cells: 4, ratio: 0.5}]");
+
+  YAML::Node * alignInput;
+  alignInput = new YAML::Node;
+  *alignInput = YAML::Clone(*input);
+  (*alignInput)["mesh"]["align to geometry"] = true;
+  (*alignInput)["geometry"]["region"] = YAML::Load("{material: fuel salt, " \
+    "inner-r: 0.0, outer-r: 0.3, lower-z: 0.1, upper-z: 0.7}");
+
+  YAML::Node * badInput;
+  badInput = new YAML::Node;
+  *badInput = YAML::Clone(*input);
+  (*badInput)["mesh"]["z edges"] = YAML::Load("[0.0, 0.6, 0.4, 1.0]");
+
+  // listed edges should be used as given
+  Mesh * edgeMesh;
+  edgeMesh = new Mesh(edgeInput);
+  if (edgeMesh->dzs.n_elem != 3 or abs(edgeMesh->dzs(0) - 0.2) > 1E-12 \
+    or abs(edgeMesh->dzs(1) - 0.3) > 1E-12 \
+    or abs(edgeMesh->dzs(2) - 0.5) > 1E-12)
+    return 1;
+
+  // graded zones should fill the domain with each cell ratio times as wide
+  // as the one before it
+  Mesh * zoneMesh;
+  zoneMesh = new Mesh(zoneInput);
+  if (zoneMesh->dzs.n_elem != 4 \
+    or abs(arma::accu(zoneMesh->dzs) - 1.0) > 1E-12)
+    return 1;
+  for (int iCell = 1; iCell < zoneMesh->dzs.n_elem; iCell++)
+    if (abs(zoneMesh->dzs(iCell)/zoneMesh->dzs(iCell-1) - 0.5) > 1E-12)
+      return 1;
+
+  // aligned cells should have edges on the region boundaries and be no wider
+  // than the uniform width
+  Mesh * alignMesh;
+  alignMesh = new Mesh(alignInput);
+  double edge = 0.0;
+  bool lowerFound = false,upperFound = false;
+  for (int iCell = 0; iCell < alignMesh->dzs.n_elem; iCell++)
+  {
+    if (alignMesh->dzs(iCell) > 0.5 + 1E-12)
+      return 1;
+    edge += alignMesh->dzs(iCell);
+    lowerFound = lowerFound or abs(edge - 0.1) < 1E-12;
+    upperFound = upperFound or abs(edge - 0.7) < 1E-12;
+  }
+  if (not lowerFound or not upperFound or abs(edge - 1.0) > 1E-12)
+    return 1;
+  if (alignMesh->drs.n_elem < 1 or abs(alignMesh->drs(0) - 0.3) > 1E-12)
+    return 1;
+
+  // edges that do not increase should be rejected
+  try
+  {
+    new Mesh(badInput);
+    return 1;
+  }
+  catch (invalid_argument & error)
+  {
+  }
 }
@@ -0,0 +1,88 @@
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/MGHOTPolicy.h"
+
+using namespace std;
+
+// whether each of two groups is set to be solved
+bool solving(MGHOTPolicy * policy,bool group0,bool group1)
+{
+  return policy->solveGroup(0) == group0 and policy->solveGroup(1) == group1;
+}
+
+Eigen::VectorXd residuals(double group0,double group1)
+{
+  Eigen::VectorXd myResiduals(2);
+  myResiduals << group0,group1;
+  return myResiduals;
+}
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  (*input)["mesh"]["T"] = 0.01;
+  (*input)["parameters"]["adaptiveMGHOT"] = true;
+  (*input)["parameters"]["mghotDriftTol"] = 1E-3;
+  (*input)["parameters"]["mghotRefreshInterval"] = 3;
+  (*input)["parameters"]["mghotResidualGrowth"] = 10.0;
+  PetscErrorCode ierr;
+  int status = 0;
+
+  Mesh * myMesh;
+  myMesh = new Mesh(input);
+
+  MGHOTPolicy * policy;
+  policy = new MGHOTPolicy(myMesh,input,2);
+
+  // first step: groups are solved until their drift within the step has
+  // been measured, then skipped once it falls below the tolerance
+  if (not policy->decide(1.0,true) or not solving(policy,true,true))
+    status = 1;
+  policy->recordEddingtonDrift(residuals(1.0,1.0));
+
+  if (not policy->decide(0.5,false) or not solving(policy,true,true))
+    status = 1;
+  policy->recordEddingtonDrift(residuals(1E-5,1E-2));
+
+  if (not policy->decide(0.1,false) or not solving(policy,false,true))
+    status = 1;
+  policy->recordEddingtonDrift(residuals(0.0,1E-6));
+
+  if (policy->decide(0.01,false) or not solving(policy,false,false))
+    status = 1;
+  myMesh->advanceOneTimeStep();
+
+  // second step: the drift across a time step has not been measured yet
+  if (not policy->decide(1.0,true) or not solving(policy,true,true))
+    status = 1;
+  policy->recordEddingtonDrift(residuals(1E-4,1E-4));
+  myMesh->advanceOneTimeStep();
+
+  // a drift of 1E-4 per step stays below the tolerance, so the groups are
+  // skipped until they reach the refresh interval
+  for (int iStep = 0; iStep < 3; iStep++)
+  {
+    if (policy->decide(1.0,true) or not solving(policy,false,false))
+      status = 1;
+    myMesh->advanceOneTimeStep();
+  }
+
+  if (not policy->decide(1.0,true) or not solving(policy,true,true))
+    status = 1;
+  policy->recordEddingtonDrift(residuals(4E-4,4E-4));
+  myMesh->advanceOneTimeStep();
+
+  // growth in the LO residual between steps forces every group to be solved
+  if (not policy->decide(20.0,true) or not solving(policy,true,true))
+    status = 1;
+
+  if (policy->driftRate(0) != 1E-4 or policy->driftRate(1) != 1E-4)
+    status = 1;
+
+  ierr = PetscFinalize();
+  return status;
+}
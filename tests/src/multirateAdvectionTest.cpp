@@ -0,0 +1,130 @@
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiPhysicsCoupledQD.h"
+#include "../../libs/MultiGroupDNP.h"
+#include "../../libs/SingleGroupDNP.h"
+#include "../../libs/HeatTransfer.h"
+
+using namespace std;
+
+// smooth, nonuniform profile so that the flux limiter is exercised
+double profile(int iZ,int iR)
+{
+  return 2.0 + cos(0.7*iZ + 0.3*iR);
+}
+
+// whether two advection rates agree to within tol relative to the first
+bool agree(const Eigen::MatrixXd & rate,const Eigen::MatrixXd & other,\
+  double tol)
+{
+  return (other - rate).norm() <= tol*rate.norm();
+}
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  (*input)["delayed neutron precursors"]["lambdas"].push_back(10.0);
+  (*input)["delayed neutron precursors"]["betas"].push_back(0.0065);
+  PetscErrorCode ierr;
+  int status = 0;
+  double velocity = 1.0,inventoryRate,fluxScale;
+
+  Mesh * myMesh;
+  myMesh = new Mesh(input);
+
+  Materials * myMaterials;
+  myMaterials = new Materials(myMesh,input);
+
+  MultiPhysicsCoupledQD * myMPQD;
+  myMPQD = new MultiPhysicsCoupledQD(myMaterials,myMesh,input);
+
+  MultiGroupDNP * mgdnp = myMPQD->mgdnp;
+  SingleGroupDNP * dnp = mgdnp->DNPs[0].get();
+  HeatTransfer * heat = myMPQD->heat;
+
+  // the number of subcycles is set by the largest Courant number, which is
+  // 1000*0.001/0.25 = 4 here
+  myMaterials->flowVelocity.setConstant(1000.0);
+  myMaterials->recircFlowVelocity.setConstant(1000.0);
+
+  mgdnp->advSubcycles = 3;
+  heat->advSubcycles = 3;
+  if (dnp->calcNumSubcycles(myMesh->dt) != 3 \
+    or heat->calcNumSubcycles(myMesh->dt) != 3)
+    status = 1;
+
+  mgdnp->advCourant = 0.5;
+  heat->advCourant = 0.5;
+  if (dnp->calcNumSubcycles(myMesh->dt) != 8 \
+    or heat->calcNumSubcycles(myMesh->dt) != 8)
+    status = 1;
+
+  mgdnp->advCourant = 0.0;
+  heat->advCourant = 0.0;
+
+  // at a small Courant number subcycling should barely change the rates
+  myMaterials->flowVelocity.setConstant(velocity);
+  myMaterials->recircFlowVelocity.setConstant(velocity);
+
+  for (int iZ = 0; iZ < dnp->dnpConc.rows(); iZ++)
+  {
+    for (int iR = 0; iR < dnp->dnpConc.cols(); iR++)
+    {
+      dnp->dnpConc(iZ,iR) = profile(iZ,iR);
+      heat->temp(iZ,iR) = 900.0 + 10.0*profile(iZ,iR);
+    }
+  }
+  for (int iZ = 0; iZ < dnp->recircConc.rows(); iZ++)
+  {
+    for (int iR = 0; iR < dnp->recircConc.cols(); iR++)
+      dnp->recircConc(iZ,iR) = profile(iZ+dnp->dnpConc.rows(),iR);
+  }
+  dnp->updateBoundaryConditions();
+  heat->updateBoundaryConditions();
+
+  mgdnp->advSubcycles = 1;
+  heat->advSubcycles = 1;
+  dnp->advUpdateState = -1;
+  heat->advUpdateState = -1;
+  dnp->calcAdvectionRates();
+  heat->calcAdvectionRate();
+  Eigen::MatrixXd coreRate = dnp->coreAdvRate;
+  Eigen::MatrixXd recircRate = dnp->recircAdvRate;
+  Eigen::MatrixXd heatRate = heat->advRate;
+
+  mgdnp->advSubcycles = 4;
+  heat->advSubcycles = 4;
+  dnp->advUpdateState = -1;
+  heat->advUpdateState = -1;
+  dnp->calcAdvectionRates();
+  heat->calcAdvectionRate();
+
+  if (not agree(coreRate,dnp->coreAdvRate,1E-2) \
+    or not agree(recircRate,dnp->recircAdvRate,1E-2) \
+    or not agree(heatRate,heat->advRate,1E-2))
+    status = 1;
+
+  // the core and recirculation loop form a closed loop in each column, so
+  // the subcycled advection should only move precursors around it
+  fluxScale = velocity*dnp->dnpConc.maxCoeff();
+  for (int iR = 0; iR < dnp->dnpConc.cols(); iR++)
+  {
+    inventoryRate = 0.0;
+    for (int iZ = 0; iZ < dnp->coreAdvRate.rows(); iZ++)
+      inventoryRate += dnp->coreAdvRate(iZ,iR)*myMesh->dzsCorner(iZ);
+    for (int iZ = 0; iZ < dnp->recircAdvRate.rows(); iZ++)
+      inventoryRate += dnp->recircAdvRate(iZ,iR)\
+        *myMesh->dzsCornerRecirc(iZ);
+
+    if (abs(inventoryRate) > 1E-10*fluxScale)
+      status = 1;
+  }
+
+  ierr = PetscFinalize();
+  return status;
+}
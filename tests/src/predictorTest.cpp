@@ -0,0 +1,67 @@
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiGroupTransport.h"
+#include "../../libs/MultiGroupQD.h"
+#include "../../libs/MultiPhysicsCoupledQD.h"
+#include "../../libs/MultilevelCoupling.h"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  (*input)["mesh"]["T"] = 0.005;
+  (*input)["parameters"]["extrapolationOrder"] = 1;
+  PetscErrorCode ierr;
+  int status = 0;
+
+  Mesh * myMesh;
+  myMesh = new Mesh(input);
+
+  Materials * myMaterials;
+  myMaterials = new Materials(myMesh,input);
+
+  MultiGroupTransport * myMGT;
+  myMGT = new MultiGroupTransport(myMaterials,myMesh,input);
+
+  MultiGroupQD * myMGQD;
+  myMGQD = new MultiGroupQD(myMaterials,myMesh,input);
+
+  MultiPhysicsCoupledQD * myMPQD;
+  myMPQD = new MultiPhysicsCoupledQD(myMaterials,myMesh,input);
+
+  MultilevelCoupling * myMLCoupling;
+  myMLCoupling = new MultilevelCoupling(myMesh,myMaterials,input,myMGT,\
+    myMGQD,myMPQD);
+
+  // steps that start from an extrapolated predictor should still solve the
+  // transport problem at the new time at least once
+  for (int iTime = myMesh->state-1; iTime < myMesh->dts.size(); iTime++)
+  {
+    bool predicted = myMLCoupling->elotHistory->ready();
+
+    if (not myMLCoupling->solveOneStepResidualBalance(false))
+    {
+      status = 1;
+      break;
+    }
+    if (predicted and myMLCoupling->lastStepItersMGHOT < 1)
+    {
+      status = 1;
+      break;
+    }
+
+    myMGQD->updateVarsAfterConvergence();
+    myMPQD->updateVarsAfterConvergence();
+    myMLCoupling->storeSolutionHistory();
+    myMesh->advanceOneTimeStep();
+  }
+
+  ierr = PetscFinalize();
+  return status;
+}
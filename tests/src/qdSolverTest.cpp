@@ -2,17 +2,21 @@
 #include "../../libs/Mesh.h"
 #include "../../libs/Materials.h"
 #include "../../libs/QuasidiffusionSolver.h"
+#include "../../libs/MultiGroupQD.h"
+#include "../../libs/MultiPhysicsCoupledQD.h"
 
 using namespace std;
 
 int main(int argc, char** argv)
 {
   PetscInitialize(&argc,&argv,(char*)0,"Test");
-  
+
   YAML::Node * input;
   input = new YAML::Node;
   *input = YAML::LoadFile("inputs/1-group-test.yaml");
   PetscErrorCode ierr;
+  int status = 0;
+  Eigen::VectorXd xCondensed;
 
   // initialize mesh object
   Mesh * myMesh;
@@ -25,6 +29,42 @@ int main(int argc, char** argv)
   // initialize quasidiffusionsolver
   QDSolver * myQDSolver;
   myQDSolver = new QDSolver(myMesh,myMaterials,input);
-  
+
+  // condensing the cell center fluxes out of the MGLOQD and ELOT systems
+  // should not change their solutions
+  (*input)["parameters"]["condenseMGLOQD"] = true;
+  (*input)["parameters"]["condenseELOT"] = true;
+
+  MultiGroupQD * myMGQD;
+  myMGQD = new MultiGroupQD(myMaterials,myMesh,input);
+  myMGQD->setInitialCondition();
+  myMGQD->buildLinearSystem();
+
+  myMGQD->QDSolve->solve();
+  xCondensed = myMGQD->QDSolve->x;
+  if (not myMGQD->QDSolve->condensed)
+    status = 1;
+
+  myMGQD->QDSolve->condense = false;
+  myMGQD->QDSolve->solve();
+  if ((xCondensed - myMGQD->QDSolve->x).norm() \
+    > 1E-8*myMGQD->QDSolve->x.norm())
+    status = 1;
+
+  MultiPhysicsCoupledQD * myMPQD;
+  myMPQD = new MultiPhysicsCoupledQD(myMaterials,myMesh,input);
+  myMPQD->buildLinearSystem();
+
+  myMPQD->solveLinearSystem();
+  xCondensed = myMPQD->x;
+  if (not myMPQD->condensed)
+    status = 1;
+
+  myMPQD->condense = false;
+  myMPQD->solveLinearSystem();
+  if ((xCondensed - myMPQD->x).norm() > 1E-8*myMPQD->x.norm())
+    status = 1;
+
   ierr = PetscFinalize();
+  return status;
 }
@@ -0,0 +1,95 @@
+#include "../../TPLs/yaml-cpp/include/yaml-cpp/yaml.h"
+#include "../../libs/Mesh.h"
+#include "../../libs/Materials.h"
+#include "../../libs/MultiGroupTransport.h"
+#include "../../libs/MultiGroupQD.h"
+#include "../../libs/MultiPhysicsCoupledQD.h"
+#include "../../libs/MultilevelCoupling.h"
+
+using namespace std;
+
+struct Problem
+{
+  Mesh * mesh;
+  MultiGroupQD * mgqd;
+  MultiPhysicsCoupledQD * mpqd;
+  MultilevelCoupling * coupling;
+};
+
+Problem buildProblem(YAML::Node * input)
+{
+  Problem problem;
+
+  problem.mesh = new Mesh(input);
+  Materials * mats = new Materials(problem.mesh,input);
+  MultiGroupTransport * mgt = new MultiGroupTransport(mats,problem.mesh,input);
+  problem.mgqd = new MultiGroupQD(mats,problem.mesh,input);
+  problem.mpqd = new MultiPhysicsCoupledQD(mats,problem.mesh,input);
+  problem.coupling = new MultilevelCoupling(problem.mesh,mats,input,mgt,\
+    problem.mgqd,problem.mpqd);
+
+  return problem;
+}
+
+bool advance(Problem problem,int lastStep)
+{
+  for (int iTime = problem.mesh->state-1; iTime < lastStep; iTime++)
+  {
+    if (not problem.coupling->solveOneStepResidualBalance(false))
+      return false;
+
+    problem.mgqd->updateVarsAfterConvergence();
+    problem.mpqd->updateVarsAfterConvergence();
+    problem.coupling->storeSolutionHistory();
+    problem.mesh->advanceOneTimeStep();
+  }
+
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  PetscInitialize(&argc,&argv,(char*)0,"Test");
+
+  YAML::Node * input;
+  input = new YAML::Node;
+  *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  (*input)["mesh"]["T"] = 0.004;
+  (*input)["parameters"]["extrapolationOrder"] = 1;
+  PetscErrorCode ierr;
+  int status = 0;
+  double error;
+
+  // a run restarted from a checkpoint should finish where an uninterrupted
+  // run does
+  Problem uninterrupted = buildProblem(input);
+  Problem interrupted = buildProblem(input);
+  Problem restarted = buildProblem(input);
+  int nSteps = uninterrupted.mesh->dts.size();
+
+  if (not advance(uninterrupted,nSteps) or not advance(interrupted,nSteps/2))
+    status = 1;
+  else if (not interrupted.coupling->writeCheckpoint("restartTest.qmc"))
+    status = 1;
+  else if (not restarted.coupling->readCheckpoint("restartTest.qmc"))
+    status = 1;
+  else if (restarted.mesh->state != interrupted.mesh->state)
+    status = 1;
+  else if (not advance(restarted,nSteps))
+    status = 1;
+  else
+  {
+    error = (restarted.mpqd->x - uninterrupted.mpqd->x).norm()\
+      /uninterrupted.mpqd->x.norm();
+    if (error > 1E-10)
+      status = 1;
+
+    error = (restarted.mgqd->QDSolve->x - uninterrupted.mgqd->QDSolve->x)\
+      .norm()/uninterrupted.mgqd->QDSolve->x.norm();
+    if (error > 1E-10)
+      status = 1;
+  }
+
+  ierr = PetscFinalize();
+  return status;
+}
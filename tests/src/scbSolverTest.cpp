@@ -10,6 +10,7 @@ int main()
   YAML::Node * input;
   input = new YAML::Node;
   *input = YAML::LoadFile("inputs/1-group-test.yaml");
+  (*input)["mesh"]["dz"] = 0.25;
 
   // initialize mesh object
   Mesh * myMesh;
@@ -22,4 +23,41 @@ int main()
   // initialize quasidiffusionsolver
   SimpleCornerBalance * mySCB;
   mySCB = new SimpleCornerBalance(myMesh,myMaterials,input);
+
+  // repeated sweeps over axial subdomains with a fixed source should
+  // converge to a single sweep over the whole domain
+  int nZ = myMesh->zCornerCent.size(),nR = myMesh->rCornerCent.size();
+  int nLevels = myMesh->quadrature.size(),nSweeps = 0;
+  double difference,largest;
+  arma::cube aFlux,halfAFlux,subdomainAFlux;
+  Eigen::MatrixXd source,alpha;
+  source.setOnes(nZ,nR);
+  alpha.setOnes(nZ,nR);
+
+  aFlux.zeros(nZ,nR,myMesh->nAngles);
+  halfAFlux.zeros(nZ,nR,nLevels);
+  mySCB->solve(&aFlux,&halfAFlux,&source,&alpha,0);
+
+  mySCB->nSubdomains = 2;
+  subdomainAFlux.zeros(nZ,nR,myMesh->nAngles);
+  do
+  {
+    halfAFlux.zeros(nZ,nR,nLevels);
+    mySCB->solve(&subdomainAFlux,&halfAFlux,&source,&alpha,0);
+    nSweeps++;
+
+    difference = 0.0;
+    largest = 0.0;
+    for (int iEntry = 0; iEntry < aFlux.n_elem; iEntry++)
+    {
+      difference = max(difference,\
+        abs(subdomainAFlux.memptr()[iEntry] - aFlux.memptr()[iEntry]));
+      largest = max(largest,abs(aFlux.memptr()[iEntry]));
+    }
+  } while (difference > 1E-10*largest and nSweeps < 10);
+
+  // the inflow of each subdomain lags one sweep behind its upstream
+  // neighbour, so the first sweep cannot already match
+  if (difference > 1E-10*largest or nSweeps < 2)
+    return 1;
 }
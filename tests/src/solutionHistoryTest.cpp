@@ -0,0 +1,20 @@
+#include "../../libs/SolutionHistory.h"
+
+using namespace std;
+
+int main()
+{
+  // quadratic extrapolation should reproduce a quadratic exactly
+  SolutionHistory * history;
+  history = new SolutionHistory(2,3);
+  Eigen::VectorXd state(1);
+
+  for (double time : {0.0,0.1,0.25,0.3})
+  {
+    state(0) = time*time + 1.0;
+    history->push(time,state);
+  }
+
+  if (abs(history->extrapolate(0.5)(0) - 1.25) > 1E-12)
+    return 1;
+}